@@ -2,34 +2,873 @@
 
 #include "Basics.h"
 #include "ArithmeticFunctions.hpp"
+#include "NTTFunctions.hpp"
+#include "ToomCookFunctions.hpp"
+#include "DivisionFunctions.hpp"
+#include "SquareRootFunctions.hpp"
+#include "MontgomeryFunctions.hpp"
+#include "GcdFunctions.hpp"
+#include "ShiftFunctions.hpp"
+#include "MultiplyAddFunctions.hpp"
 
 namespace mpengine {
 
+void check_binary_operands(const BasicNodeType* operand_A, const BasicNodeType* operand_B);
+
+template<typename Callable>
+decltype(auto) dispatch_radix(const BasicIntegerType& data, Callable&& callable) {
+    //Invokes callable with the radix argument of the kernels: NativeRadix for native limbs, the WideRadix or CompactRadix of the store base otherwise.
+    if (data.radix == StoreRadix::native) {
+        return callable(NativeRadix{});
+    }
+    if (data.radix == StoreRadix::wide) {
+        switch (data.iobasic) {
+            case IOBasic::oct: return callable(WideRadix<iofun::store_base(IOBasic::oct, StoreRadix::wide)>{});
+            case IOBasic::hex: return callable(WideRadix<iofun::store_base(IOBasic::hex, StoreRadix::wide)>{});
+            default: return callable(WideRadix<iofun::store_base(IOBasic::dec, StoreRadix::wide)>{});
+        }
+    }
+    switch (data.iobasic) {
+        case IOBasic::oct: return callable(CompactRadix<iofun::store_base(IOBasic::oct)>{});
+        case IOBasic::hex: return callable(CompactRadix<iofun::store_base(IOBasic::hex)>{});
+        default: return callable(CompactRadix<iofun::store_base(IOBasic::dec)>{});
+    }
+}
+
 class ArithmeticAddNodeForInteger: public BasicBinaryOperation {
 public:
     using DataHandle = BasicNodeType::DataPtr;
     using NodeHandle = std::shared_ptr<BasicNodeType>;
     using ComputeUnitPtr = BasicComputeUnitType*;
 private:
+    /**
+     * C = A + B, or C = A - B for a subtraction node, which flips the sign of B instead of negating its limbs.
+     * Operands of opposite (effective) signs are subtracted without comparing them first: |A| - |B| is computed
+     * modulo base ^ len, and a borrow out of the top limb means |A| < |B|, when the wrapped difference is
+     * complemented into |B| - |A|.
+     */
     struct ArithmeticAddTaskForInteger: public putils::Task {
         DataHandle source_A;
         DataHandle source_B;
         DataHandle target_C;
+        const bool subtract;
         const ComputeUnitPtr curr_unit;
         ArithmeticAddTaskForInteger(
             const DataHandle& source_A,
             const DataHandle& source_B,
             const DataHandle& target_C,
+            const bool subtract,
             const ComputeUnitPtr curr_unit
         );
         ~ArithmeticAddTaskForInteger() override = default;
         void run() override;
         std::string description() const noexcept override;
     };
+    /**
+     * Carry-select addition of large operands, whose used limbs are split into chunks:
+     * - prepare: the signs of the operands select adding or subtracting the magnitudes,
+     *   and the used limbs (plus the limb of a carry) are split evenly into the chunks,
+     * - chunk: every chunk is added (subtracted) without an incoming carry, recording its carry out and
+     *   whether an incoming carry would ripple through the whole chunk (all limbs base - 1, resp. 0),
+     * - resolve: the carries are chained over the chunks and added into the chunks receiving one,
+     *   and the used limbs of the sum are recorded. A borrow out of the top chunk of a subtraction means
+     *   |A| < |B|, the wrapped difference is then complemented, as in the serial task.
+     */
+    struct AdditionWorkspace {
+        enum class Mode { add, subtract };
+        DataHandle source_A;
+        DataHandle source_B;
+        DataHandle target_C;
+        const bool subtract;
+        Mode mode;
+        size_t length;
+        std::vector<size_t> bounds;
+        std::vector<uint8_t> carries;
+        std::vector<uint8_t> propagates;
+        AdditionWorkspace(
+            const DataHandle& source_A,
+            const DataHandle& source_B,
+            const DataHandle& target_C,
+            const bool subtract,
+            size_t chunks
+        );
+        void prepare();
+        void compute(size_t chunk_index) noexcept;
+        void resolve();
+    };
+    using AdditionWorkspaceHandle = std::shared_ptr<AdditionWorkspace>;
+    struct AdditionStageTaskForInteger: public putils::Task {
+        enum class Stage { prepare, chunk, resolve };
+        AdditionWorkspaceHandle workspace;
+        const Stage stage;
+        const size_t index;
+        const ComputeUnitPtr curr_unit;
+        AdditionStageTaskForInteger(
+            const AdditionWorkspaceHandle& workspace,
+            const Stage stage,
+            const size_t index,
+            const ComputeUnitPtr curr_unit
+        );
+        ~AdditionStageTaskForInteger() override = default;
+        void run() override;
+        std::string description() const noexcept override;
+    };
+    bool subtract;
+    size_t carry_select_chunks() const;
+    void generate_carry_select_procedure(size_t chunks);
+    friend class ArithmeticMulAddNodeForInteger;
 public:
-    ArithmeticAddNodeForInteger(NodeHandle& node_A, NodeHandle& node_B);
+    ArithmeticAddNodeForInteger(NodeHandle& node_A, NodeHandle& node_B, const bool subtract = false);
     ~ArithmeticAddNodeForInteger() override = default;
     void generate_procedure() override;
+    void estimate_bound() noexcept override;
+};
+
+class ArithmeticNegNodeForInteger: public BasicTransformation {
+public:
+    using DataHandle = BasicNodeType::DataPtr;
+    using NodeHandle = std::shared_ptr<BasicNodeType>;
+    using ComputeUnitPtr = BasicComputeUnitType*;
+private:
+    /**
+     * C = -A as a view of the limbs of A (see BasicIntegerView), the task only binds the block and flips the sign.
+     * A zero keeps the positive sign.
+     */
+    struct ArithmeticNegTaskForInteger: public putils::Task {
+        DataHandle source;
+        DataHandle target;
+        const ComputeUnitPtr curr_unit;
+        ArithmeticNegTaskForInteger(
+            const DataHandle& source,
+            const DataHandle& target,
+            const ComputeUnitPtr curr_unit
+        );
+        ~ArithmeticNegTaskForInteger() override = default;
+        void run() override;
+        std::string description() const noexcept override;
+    };
+public:
+    ArithmeticNegNodeForInteger(NodeHandle& node);
+    ~ArithmeticNegNodeForInteger() override = default;
+    void generate_procedure() override;
+};
+
+class ArithmeticSumNodeForInteger: public BasicNodeType {
+public:
+    using DataHandle = BasicNodeType::DataPtr;
+    using NodeHandle = std::shared_ptr<BasicNodeType>;
+    using ComputeUnitPtr = BasicComputeUnitType*;
+    using BlockHandle = BasicIntegerType::BlockHandle;
+    using ElementPtr = BasicIntegerType::ElementType*;
+private:
+    /**
+     * C = A_0 + A_1 + ... + A_(k-1) in a single node. The operands are split into groups, and every group sums
+     * the magnitudes of its positive and of its negative operands into two partial sums:
+     * - prepare: every buffer is allocated,
+     * - gather: the limbs of the group are added without carries (compact radices, where a limb below base
+     *   leaves room for UINT64_MAX / base additions), or with carries for the native and wide radices,
+     * - normalize: the partial sums of the groups are added the same way, a single carry pass normalizes
+     *   both sums, and C is their difference.
+     * Every stage works on the width of the longest operand (two limbs more for the carries), not the capacity.
+     */
+    struct SummationWorkspace {
+        std::vector<DataHandle> sources;
+        DataHandle target;
+        std::vector<size_t> bounds;
+        std::vector<BlockHandle> partials;
+        std::vector<uint8_t> carries;
+        size_t width;
+        SummationWorkspace(const std::vector<DataHandle>& sources, const DataHandle& target, size_t groups);
+        ~SummationWorkspace();
+        void prepare();
+        void gather(size_t group_index);
+        void normalize();
+    };
+    using SummationWorkspaceHandle = std::shared_ptr<SummationWorkspace>;
+    struct SummationStageTaskForInteger: public putils::Task {
+        enum class Stage { prepare, gather, normalize, serial };
+        SummationWorkspaceHandle workspace;
+        const Stage stage;
+        const size_t index;
+        const ComputeUnitPtr curr_unit;
+        SummationStageTaskForInteger(
+            const SummationWorkspaceHandle& workspace,
+            const Stage stage,
+            const size_t index,
+            const ComputeUnitPtr curr_unit
+        );
+        ~SummationStageTaskForInteger() override = default;
+        void run() override;
+        std::string description() const noexcept override;
+    };
+public:
+    NodePtrList operands;
+    ArithmeticSumNodeForInteger(std::vector<NodeHandle>& nodes);
+    ~ArithmeticSumNodeForInteger() override = default;
+    void generate_procedure() override;
+    void replace_operand(NodePtr node, NodePtr replacement) noexcept override;
+    void estimate_bound() noexcept override;
+};
+
+class ArithmeticScalarNodeForInteger: public BasicTransformation {
+public:
+    using DataHandle = BasicNodeType::DataPtr;
+    using NodeHandle = std::shared_ptr<BasicNodeType>;
+    using ComputeUnitPtr = BasicComputeUnitType*;
+    enum class Operation { multiply, divide, modulo };
+private:
+    /**
+     * C = A * s, A / s or A % s for a machine word s held by the node itself, one linear pass over A.
+     * The quotient is rounded toward zero and the remainder takes the sign of A, as for the division node.
+     */
+    struct ArithmeticScalarTaskForInteger: public putils::Task {
+        DataHandle source;
+        DataHandle target;
+        const Operation operation;
+        const uint64_t scalar;
+        const ComputeUnitPtr curr_unit;
+        ArithmeticScalarTaskForInteger(
+            const DataHandle& source,
+            const DataHandle& target,
+            const Operation operation,
+            const uint64_t scalar,
+            const ComputeUnitPtr curr_unit
+        );
+        ~ArithmeticScalarTaskForInteger() override = default;
+        void run() override;
+        std::string description() const noexcept override;
+    };
+    const Operation operation;
+    const uint64_t scalar;
+public:
+    ArithmeticScalarNodeForInteger(NodeHandle& node, const Operation operation, const uint64_t scalar);
+    ~ArithmeticScalarNodeForInteger() override = default;
+    void generate_procedure() override;
+    void estimate_bound() noexcept override;
+};
+
+class ArithmeticShiftNodeForInteger: public BasicTransformation {
+public:
+    using DataHandle = BasicNodeType::DataPtr;
+    using NodeHandle = std::shared_ptr<BasicNodeType>;
+    using ComputeUnitPtr = BasicComputeUnitType*;
+    enum class Direction { left, right };
+    enum class Unit { bit, digit };
+private:
+    /**
+     * C = A * F or C = A / F (rounded toward zero, keeping the sign of A) for F = 2 ^ count or io_base ^ count.
+     * When F = base ^ limbs * m with m dividing the store base (see ShiftFunctions.hpp), the output limbs are
+     * independent of each other and large operands are shifted by chunks:
+     * - prepare: the target is allocated and the output limbs the used source limbs reach are split into chunks,
+     * - chunk: every chunk of output limbs is written from the two source limbs it reads,
+     * - finalize: the sign and the overflow of a left shift are settled.
+     * Other factors (bit shifts in the decimal radix, decimal digits in the native radix) are applied by
+     * repeated scalar passes in a single task.
+     */
+    struct ShiftWorkspace {
+        DataHandle source;
+        DataHandle target;
+        const Direction direction;
+        const uint64_t unit;
+        const size_t count;
+        ShiftPlan plan;
+        bool overflow;
+        size_t length;
+        std::vector<size_t> bounds;
+        ShiftWorkspace(
+            const DataHandle& source,
+            const DataHandle& target,
+            const Direction direction,
+            const uint64_t unit,
+            const size_t count,
+            size_t chunks
+        );
+        void prepare();
+        void compute(size_t chunk_index) noexcept;
+        void finalize();
+        void serial();
+    };
+    using ShiftWorkspaceHandle = std::shared_ptr<ShiftWorkspace>;
+    struct ShiftStageTaskForInteger: public putils::Task {
+        enum class Stage { prepare, chunk, finalize, serial };
+        ShiftWorkspaceHandle workspace;
+        const Stage stage;
+        const size_t index;
+        const ComputeUnitPtr curr_unit;
+        ShiftStageTaskForInteger(
+            const ShiftWorkspaceHandle& workspace,
+            const Stage stage,
+            const size_t index,
+            const ComputeUnitPtr curr_unit
+        );
+        ~ShiftStageTaskForInteger() override = default;
+        void run() override;
+        std::string description() const noexcept override;
+    };
+    const Direction direction;
+    const Unit unit;
+    const size_t count;
+public:
+    ArithmeticShiftNodeForInteger(NodeHandle& node, const Direction direction, const Unit unit, const size_t count);
+    ~ArithmeticShiftNodeForInteger() override = default;
+    void generate_procedure() override;
+    void estimate_bound() noexcept override;
+};
+
+class ArithmeticMulNodeForInteger: public BasicBinaryOperation {
+public:
+    using DataHandle = BasicNodeType::DataPtr;
+    using NodeHandle = std::shared_ptr<BasicNodeType>;
+    using ComputeUnitPtr = BasicComputeUnitType*;
+    using BlockHandle = BasicIntegerType::BlockHandle;
+    using ElementPtr = BasicIntegerType::ElementType*;
+private:
+    /**
+     * The upper levels of the Karatsuba recursion are unrolled into frames when the procedure is generated.
+     * Frames are stored in pre-order, so children always follow their parents:
+     * - split() walks the frames forward and prepares the middle operands (a0 + a1, b0 + b1),
+     * - every leaf frame is an independent product task,
+     * - merge() walks the frames backward and folds the middle products into their parents.
+     * Products of the low and high children are written directly into the halves of the parent product.
+     * For a square the middle operands coincide and every leaf takes the squaring kernel.
+     * The procedure is generated for the length expected from the bounds of the operands. split() plans the frames
+     * again for the used limbs of the operands, and leaf tasks beyond the leaves of that plan have nothing to do,
+     * while leaves beyond the generated tasks (planned_leaves) are left to merge().
+     * Every procedure first measures the used limbs of the operands (see measure_product_operands()): an operand
+     * within the schoolbook threshold is multiplied directly (direct), and the remaining stages have nothing to do.
+     */
+    struct KaratsubaFrame {
+        size_t length, half;
+        size_t children[3];
+        size_t sums_offset, middle_offset, scratch_offset;
+        ElementPtr operand_A, operand_B, product;
+        bool carry_A, carry_B, leaf;
+    };
+    struct KaratsubaWorkspace {
+        DataHandle source_A;
+        DataHandle source_B;
+        DataHandle target_C;
+        BlockHandle block;
+        std::vector<KaratsubaFrame> frames;
+        std::vector<size_t> leaves;
+        size_t total_length, threshold, depth, planned_leaves;
+        bool direct;
+        const bool square;
+        KaratsubaWorkspace(
+            const DataHandle& source_A,
+            const DataHandle& source_B,
+            const DataHandle& target_C,
+            size_t length,
+            size_t threshold,
+            size_t depth,
+            bool square
+        );
+        ~KaratsubaWorkspace();
+        size_t plan(size_t length, size_t depth);
+        void split();
+        void multiply(size_t leaf_index) noexcept;
+        void merge();
+    };
+    using WorkspaceHandle = std::shared_ptr<KaratsubaWorkspace>;
+    struct KaratsubaSplitTaskForInteger: public putils::Task {
+        WorkspaceHandle workspace;
+        const ComputeUnitPtr curr_unit;
+        KaratsubaSplitTaskForInteger(const WorkspaceHandle& workspace, const ComputeUnitPtr curr_unit);
+        ~KaratsubaSplitTaskForInteger() override = default;
+        void run() override;
+        std::string description() const noexcept override;
+    };
+    struct KaratsubaLeafTaskForInteger: public putils::Task {
+        WorkspaceHandle workspace;
+        const size_t leaf_index;
+        const ComputeUnitPtr curr_unit;
+        KaratsubaLeafTaskForInteger(const WorkspaceHandle& workspace, const size_t leaf_index, const ComputeUnitPtr curr_unit);
+        ~KaratsubaLeafTaskForInteger() override = default;
+        void run() override;
+        std::string description() const noexcept override;
+    };
+    struct KaratsubaMergeTaskForInteger: public putils::Task {
+        WorkspaceHandle workspace;
+        const ComputeUnitPtr curr_unit;
+        const bool serial;
+        KaratsubaMergeTaskForInteger(const WorkspaceHandle& workspace, const ComputeUnitPtr curr_unit, const bool serial = false);
+        ~KaratsubaMergeTaskForInteger() override = default;
+        void run() override;
+        std::string description() const noexcept override;
+    };
+    /**
+     * Three-prime NTT multiplication for operands beyond the NTT threshold:
+     * - prepare: the used limbs of the operands are measured and the transform length is fitted to them,
+     * - forward: each operand is reduced and transformed under each prime (6 independent tasks, 3 for a square),
+     * - pointwise: the transformed operands are multiplied (or the single one squared) chunk by chunk,
+     * - inverse: one inverse transform per prime,
+     * - recombine: the coefficients are recovered by CRT and normalized into the store base.
+     */
+    struct NTTWorkspace {
+        DataHandle source_A;
+        DataHandle source_B;
+        DataHandle target_C;
+        BlockHandle blocks[2][ntt_prime_count];
+        size_t pieces;
+        size_t length;
+        size_t transform_length;
+        bool direct;
+        const bool square;
+        NTTWorkspace(
+            const DataHandle& source_A,
+            const DataHandle& source_B,
+            const DataHandle& target_C,
+            size_t length,
+            bool square
+        );
+        ~NTTWorkspace();
+        uint32_t* get_transform(size_t operand_index, size_t prime_index) const noexcept;
+        void prepare();
+        void forward(size_t operand_index, size_t prime_index);
+        void pointwise(size_t prime_index, size_t chunk_index, size_t chunks) noexcept;
+        void inverse(size_t prime_index);
+        void recombine();
+    };
+    using NTTWorkspaceHandle = std::shared_ptr<NTTWorkspace>;
+    struct NTTStageTaskForInteger: public putils::Task {
+        enum class Stage { prepare, forward, pointwise, inverse, recombine };
+        NTTWorkspaceHandle workspace;
+        const Stage stage;
+        const size_t prime_index, begin, end;
+        const ComputeUnitPtr curr_unit;
+        NTTStageTaskForInteger(
+            const NTTWorkspaceHandle& workspace,
+            const Stage stage,
+            const size_t prime_index,
+            const size_t begin,
+            const size_t end,
+            const ComputeUnitPtr curr_unit
+        );
+        ~NTTStageTaskForInteger() override = default;
+        void run() override;
+        std::string description() const noexcept override;
+    };
+    /**
+     * Toom-Cook multiplication (Toom-3 or Toom-4) between the Karatsuba and the NTT tiers:
+     * - evaluate: the used limbs of both operands are split and evaluated at the points of the scheme (only one for a square),
+     * - products: one independent Karatsuba product (or square) per evaluation point (5 or 7 tasks),
+     * - interpolate: one independent task per coefficient of the product polynomial,
+     * - compose: the coefficients are added up at their offsets.
+     */
+    struct ToomCookWorkspace {
+        DataHandle source_A;
+        DataHandle source_B;
+        DataHandle target_C;
+        BlockHandle block;
+        const ToomCookScheme& scheme;
+        size_t length, part_length, width, product_length, scratch_length, threshold;
+        bool signs_A[ToomCookScheme::MAX_POINTS], signs_B[ToomCookScheme::MAX_POINTS], signs[ToomCookScheme::MAX_POINTS];
+        bool direct;
+        const bool square;
+        ToomCookWorkspace(
+            const DataHandle& source_A,
+            const DataHandle& source_B,
+            const DataHandle& target_C,
+            const ToomCookScheme& scheme,
+            size_t length,
+            size_t threshold,
+            bool square
+        );
+        ~ToomCookWorkspace();
+        void fit(size_t length) noexcept;
+        ElementPtr get_values(size_t operand_index) const noexcept;
+        ElementPtr get_products() const noexcept;
+        ElementPtr get_coefficients() const noexcept;
+        ElementPtr get_scratch(size_t index) const noexcept;
+        ElementPtr get_result() const noexcept;
+        void evaluate();
+        void multiply(size_t point_index) noexcept;
+        void interpolate(size_t coefficient_index) noexcept;
+        void compose();
+    };
+    using ToomCookWorkspaceHandle = std::shared_ptr<ToomCookWorkspace>;
+    struct ToomCookStageTaskForInteger: public putils::Task {
+        enum class Stage { evaluate, multiply, interpolate, compose };
+        ToomCookWorkspaceHandle workspace;
+        const Stage stage;
+        const size_t index;
+        const ComputeUnitPtr curr_unit;
+        ToomCookStageTaskForInteger(
+            const ToomCookWorkspaceHandle& workspace,
+            const Stage stage,
+            const size_t index,
+            const ComputeUnitPtr curr_unit
+        );
+        ~ToomCookStageTaskForInteger() override = default;
+        void run() override;
+        std::string description() const noexcept override;
+    };
+    //A * A shares one operand node, the product is then computed by the squaring variants of every tier.
+    bool square;
+    void generate_karatsuba_procedure(size_t length);
+    void generate_toom_cook_procedure(const ToomCookScheme& scheme, size_t length);
+    void generate_ntt_procedure(size_t length);
+public:
+    ArithmeticMulNodeForInteger(NodeHandle& node_A, NodeHandle& node_B);
+    ~ArithmeticMulNodeForInteger() override = default;
+    void generate_procedure() override;
+    void estimate_bound() noexcept override;
+};
+
+class ArithmeticMulAddNodeForInteger: public BasicTernaryOperation {
+public:
+    using DataHandle = BasicNodeType::DataPtr;
+    using NodeHandle = std::shared_ptr<BasicNodeType>;
+    using ComputeUnitPtr = BasicComputeUnitType*;
+    using ElementPtr = BasicIntegerType::ElementType*;
+private:
+    /**
+     * Fused D = (+-) A * B (+-) C, built by IntegerDAGContext::fuse_multiply_add() from a multiplication node whose
+     * only consumer is an addition (subtraction) node. The product is accumulated directly into a copy of C (see
+     * MultiplyAddFunctions.hpp). When the signs differ, C is complemented first: the sum then wraps around
+     * base ^ len exactly when |A * B| >= |C|, otherwise complementing it back gives |C| - |A * B|.
+     */
+    struct ArithmeticMulAddTaskForInteger: public putils::Task {
+        DataHandle source_A;
+        DataHandle source_B;
+        DataHandle source_C;
+        DataHandle target_D;
+        const bool negate_product, negate_accumulator;
+        const size_t karatsuba_threshold, ntt_threshold;
+        const ComputeUnitPtr curr_unit;
+        ArithmeticMulAddTaskForInteger(
+            const DataHandle& source_A,
+            const DataHandle& source_B,
+            const DataHandle& source_C,
+            const DataHandle& target_D,
+            const bool negate_product,
+            const bool negate_accumulator,
+            size_t karatsuba_threshold,
+            size_t ntt_threshold,
+            const ComputeUnitPtr curr_unit
+        );
+        ~ArithmeticMulAddTaskForInteger() override = default;
+        void run() override;
+        std::string description() const noexcept override;
+    };
+    bool negate_product, negate_accumulator;
+public:
+    //Takes over the data and the consumers of node_add, which must be the only consumer of node_mul.
+    ArithmeticMulAddNodeForInteger(ArithmeticAddNodeForInteger& node_add, ArithmeticMulNodeForInteger& node_mul);
+    ~ArithmeticMulAddNodeForInteger() override = default;
+    void generate_procedure() override;
+    void estimate_bound() noexcept override;
+};
+
+class ArithmeticDivNodeForInteger: public BasicBinaryOperation {
+public:
+    using DataHandle = BasicNodeType::DataPtr;
+    using NodeHandle = std::shared_ptr<BasicNodeType>;
+    using ComputeUnitPtr = BasicComputeUnitType*;
+    using BlockHandle = BasicIntegerType::BlockHandle;
+    using ElementPtr = BasicIntegerType::ElementType*;
+    enum class Output { quotient, remainder };
+private:
+    /**
+     * Truncated division A = Q * B + R, the quotient is rounded toward zero and the remainder takes the sign of A.
+     * Single-limb divisors are divided directly, short quotients or divisors by the schoolbook algorithm (Knuth D).
+     * Otherwise the normalized divisor D is inverted by Newton iteration with precision doubling, starting from
+     * a short schoolbook reciprocal. Each iteration from h to H leading limbs of D (V_h = floor(base ^ 2h / D_h)):
+     * - residual: T = base ^ (H + h) - D_H * V_h,
+     * - update: V_H = V_h * base ^ (H - h) + floor(V_h * T / base ^ 2h),
+     * - verify: V_H is corrected to floor(base ^ 2H / D_H) from the exact residual of D_H * V_H.
+     * The quotient is estimated from the leading limbs of A times the reciprocal (estimate) and corrected
+     * by the exact remainder A - Q * D (finalize).
+     * Every product is split into chunks of one operand computed in parallel, the stage consuming the product
+     * sums the partial products. Iterations planned for the longest divisor but not needed at runtime are skipped.
+     */
+    struct DivisionWorkspace {
+        enum class Mode { zero, trivial, small, schoolbook, newton };
+        enum class Step { residual, update, verify, estimate, finalize };
+        DataHandle source_A;
+        DataHandle source_B;
+        DataHandle target_C;
+        BlockHandle block;
+        const Output output;
+        Mode mode;
+        size_t chunks, threshold, karatsuba_threshold, ntt_threshold;
+        size_t length_A, length_B, length_Q, length_R, length_V, length_T;
+        size_t precision, padding, factor;
+        size_t max_steps, first_slot;
+        std::vector<size_t> ladder;
+        bool negative;
+        ElementPtr product_X, product_Y;
+        size_t product_length_X, product_length_Y;
+        std::vector<BlockHandle> partials;
+        DivisionWorkspace(
+            const DataHandle& source_A,
+            const DataHandle& source_B,
+            const DataHandle& target_C,
+            const Output output,
+            size_t chunks,
+            size_t threshold,
+            size_t karatsuba_threshold,
+            size_t ntt_threshold
+        );
+        ~DivisionWorkspace();
+        ElementPtr get_buffer(size_t index) const noexcept;
+        bool active(size_t slot) const noexcept;
+        void schedule(const ElementPtr X, size_t length_X, const ElementPtr Y, size_t length_Y) noexcept;
+        void schedule_iteration(size_t slot) noexcept;
+        void gather();
+        void prepare();
+        void multiply(size_t slot, size_t chunk_index);
+        void combine(size_t slot, Step step);
+        void finalize();
+        template<typename Radix> void prepare(const Radix base);
+        template<typename Radix> void combine(size_t slot, Step step, const Radix base);
+        template<typename Radix> void finalize(const Radix base);
+    };
+    using DivisionWorkspaceHandle = std::shared_ptr<DivisionWorkspace>;
+    struct DivisionStageTaskForInteger: public putils::Task {
+        enum class Stage { prepare, multiply, combine };
+        using Step = DivisionWorkspace::Step;
+        DivisionWorkspaceHandle workspace;
+        const Stage stage;
+        const Step step;
+        const size_t slot, index;
+        const ComputeUnitPtr curr_unit;
+        DivisionStageTaskForInteger(
+            const DivisionWorkspaceHandle& workspace,
+            const Stage stage,
+            const Step step,
+            const size_t slot,
+            const size_t index,
+            const ComputeUnitPtr curr_unit
+        );
+        ~DivisionStageTaskForInteger() override = default;
+        void run() override;
+        std::string description() const noexcept override;
+    };
+    const Output output;
+public:
+    ArithmeticDivNodeForInteger(NodeHandle& node_A, NodeHandle& node_B, const Output output = Output::quotient);
+    ~ArithmeticDivNodeForInteger() override = default;
+    void generate_procedure() override;
+};
+
+class ArithmeticSqrtNodeForInteger: public BasicTransformation {
+public:
+    using DataHandle = BasicNodeType::DataPtr;
+    using NodeHandle = std::shared_ptr<BasicNodeType>;
+    using ComputeUnitPtr = BasicComputeUnitType*;
+    using BlockHandle = BasicIntegerType::BlockHandle;
+    using ElementPtr = BasicIntegerType::ElementType*;
+    enum class Output { root, remainder };
+private:
+    /**
+     * Integer square root S = floor(sqrt(A)) and remainder R = A - S ^ 2 of a non-negative A.
+     * The reciprocal square root is refined by Newton iteration with precision doubling (see SquareRootFunctions.hpp),
+     * every iteration being a unit that only reads the leading limbs of A it needs, so that only the last one
+     * touches the full length. The root is then estimated from A times the reciprocal and corrected by the remainder.
+     * Iterations planned for the longest operand but not needed at runtime are skipped.
+     */
+    struct SquareRootWorkspace {
+        enum class Mode { zero, newton };
+        DataHandle source;
+        DataHandle target;
+        BlockHandle block;
+        const Output output;
+        Mode mode;
+        size_t karatsuba_threshold, ntt_threshold;
+        size_t length_N, precision, length_Y;
+        size_t max_steps, first_slot;
+        std::vector<size_t> ladder;
+        SquareRootWorkspace(
+            const DataHandle& source,
+            const DataHandle& target,
+            const Output output,
+            size_t karatsuba_threshold,
+            size_t ntt_threshold
+        );
+        ~SquareRootWorkspace();
+        ElementPtr get_buffer(size_t index) const noexcept;
+        void prepare();
+        void iterate(size_t slot);
+        void finalize();
+    };
+    using SquareRootWorkspaceHandle = std::shared_ptr<SquareRootWorkspace>;
+    struct SquareRootStageTaskForInteger: public putils::Task {
+        enum class Stage { prepare, iterate, finalize };
+        SquareRootWorkspaceHandle workspace;
+        const Stage stage;
+        const size_t slot;
+        const ComputeUnitPtr curr_unit;
+        SquareRootStageTaskForInteger(
+            const SquareRootWorkspaceHandle& workspace,
+            const Stage stage,
+            const size_t slot,
+            const ComputeUnitPtr curr_unit
+        );
+        ~SquareRootStageTaskForInteger() override = default;
+        void run() override;
+        std::string description() const noexcept override;
+    };
+    const Output output;
+public:
+    ArithmeticSqrtNodeForInteger(NodeHandle& node, const Output output = Output::root);
+    ~ArithmeticSqrtNodeForInteger() override = default;
+    void generate_procedure() override;
+};
+
+class ArithmeticPowModNodeForInteger: public BasicTernaryOperation {
+public:
+    using DataHandle = BasicNodeType::DataPtr;
+    using NodeHandle = std::shared_ptr<BasicNodeType>;
+    using ComputeUnitPtr = BasicComputeUnitType*;
+    using BlockHandle = BasicIntegerType::BlockHandle;
+    using ElementPtr = BasicIntegerType::ElementType*;
+private:
+    /**
+     * Modular exponentiation C = A ^ B mod M (0 <= C < |M|) by sliding windows over the bits of B.
+     * For a power-of-two radix (native, compact and wide hex and oct) and an odd modulus the residues are kept in Montgomery
+     * form, otherwise every product is reduced by the schoolbook division. The exponentiation is inherently
+     * sequential, so a node is a single task: independent exponentiations are independent roots of the DAG
+     * and run concurrently on the thread pool.
+     */
+    struct ArithmeticPowModTaskForInteger: public putils::Task {
+        DataHandle source_A;
+        DataHandle source_B;
+        DataHandle source_M;
+        DataHandle target_C;
+        const size_t karatsuba_threshold, ntt_threshold;
+        const ComputeUnitPtr curr_unit;
+        ArithmeticPowModTaskForInteger(
+            const DataHandle& source_A,
+            const DataHandle& source_B,
+            const DataHandle& source_M,
+            const DataHandle& target_C,
+            size_t karatsuba_threshold,
+            size_t ntt_threshold,
+            const ComputeUnitPtr curr_unit
+        );
+        ~ArithmeticPowModTaskForInteger() override = default;
+        void run() override;
+        std::string description() const noexcept override;
+        template<typename Radix>
+        void exponentiate(ElementPtr modulus, size_t length_M, ElementPtr result, const Radix base);
+    };
+public:
+    ArithmeticPowModNodeForInteger(NodeHandle& node_A, NodeHandle& node_B, NodeHandle& node_M);
+    ~ArithmeticPowModNodeForInteger() override = default;
+    void generate_procedure() override;
+};
+
+class ArithmeticGcdNodeForInteger: public BasicBinaryOperation {
+public:
+    using DataHandle = BasicNodeType::DataPtr;
+    using NodeHandle = std::shared_ptr<BasicNodeType>;
+    using ComputeUnitPtr = BasicComputeUnitType*;
+    using ElementPtr = BasicIntegerType::ElementType*;
+    enum class Output { gcd, cofactor_A, cofactor_B };
+private:
+    /**
+     * Greatest common divisor G = gcd(|A|, |B|) and the cofactors S, T of S * A + T * B = G.
+     * Operands of at least hgcd_threshold limbs are reduced by half-GCDs, shorter ones by Lehmer steps
+     * (see GcdFunctions.hpp). The cofactors are read off the product of all the reduction matrices,
+     * which the plain gcd does not accumulate. The reduction is sequential, so a node is a single task.
+     */
+    struct ArithmeticGcdTaskForInteger: public putils::Task {
+        DataHandle source_A;
+        DataHandle source_B;
+        DataHandle target_C;
+        const Output output;
+        const size_t hgcd_threshold, karatsuba_threshold, ntt_threshold;
+        const ComputeUnitPtr curr_unit;
+        ArithmeticGcdTaskForInteger(
+            const DataHandle& source_A,
+            const DataHandle& source_B,
+            const DataHandle& target_C,
+            const Output output,
+            size_t hgcd_threshold,
+            size_t karatsuba_threshold,
+            size_t ntt_threshold,
+            const ComputeUnitPtr curr_unit
+        );
+        ~ArithmeticGcdTaskForInteger() override = default;
+        void run() override;
+        std::string description() const noexcept override;
+    };
+    const Output output;
+public:
+    ArithmeticGcdNodeForInteger(NodeHandle& node_A, NodeHandle& node_B, const Output output = Output::gcd);
+    ~ArithmeticGcdNodeForInteger() override = default;
+    void generate_procedure() override;
+};
+
+class ArithmeticCompareNodeForInteger: public BasicBinaryOperation {
+public:
+    using DataHandle = BasicNodeType::DataPtr;
+    using NodeHandle = std::shared_ptr<BasicNodeType>;
+    using ComputeUnitPtr = BasicComputeUnitType*;
+    using ElementPtr = BasicIntegerType::ElementType*;
+    enum class Relation { compare, less, equal };
+private:
+    /**
+     * C = cmp(A, B) in {-1, 0, 1}, or the predicate A < B (A == B) in {0, 1}. The signs decide first, then the
+     * used lengths and the limbs from the top, so equal prefixes are the only ones read in full.
+     * The result is a single limb, and a consumer selecting on it (see ArithmeticSelectNodeForInteger) only tests
+     * whether it is nonzero.
+     */
+    struct ArithmeticCompareTaskForInteger: public putils::Task {
+        DataHandle source_A;
+        DataHandle source_B;
+        DataHandle target_C;
+        const Relation relation;
+        const ComputeUnitPtr curr_unit;
+        ArithmeticCompareTaskForInteger(
+            const DataHandle& source_A,
+            const DataHandle& source_B,
+            const DataHandle& target_C,
+            const Relation relation,
+            const ComputeUnitPtr curr_unit
+        );
+        ~ArithmeticCompareTaskForInteger() override = default;
+        void run() override;
+        std::string description() const noexcept override;
+    };
+    const Relation relation;
+public:
+    ArithmeticCompareNodeForInteger(NodeHandle& node_A, NodeHandle& node_B, const Relation relation = Relation::compare);
+    ~ArithmeticCompareNodeForInteger() override = default;
+    void generate_procedure() override;
+    void estimate_bound() noexcept override;
+};
+
+class ArithmeticSelectNodeForInteger: public BasicTernaryOperation {
+public:
+    using DataHandle = BasicNodeType::DataPtr;
+    using NodeHandle = std::shared_ptr<BasicNodeType>;
+    using ComputeUnitPtr = BasicComputeUnitType*;
+private:
+    /**
+     * C = P ? A : B for a predicate P (operand_A) and the candidates A, B (operand_B, operand_C), nonzero P selecting A.
+     * C is a view of the candidates (see BasicIntegerSelection), the task only binds the limbs of the selected one
+     * and copies its sign, so no limb is copied and the consumers of C never wait on a branch of the host program.
+     */
+    struct ArithmeticSelectTaskForInteger: public putils::Task {
+        DataHandle predicate;
+        DataHandle target;
+        const ComputeUnitPtr curr_unit;
+        ArithmeticSelectTaskForInteger(
+            const DataHandle& predicate,
+            const DataHandle& target,
+            const ComputeUnitPtr curr_unit
+        );
+        ~ArithmeticSelectTaskForInteger() override = default;
+        void run() override;
+        std::string description() const noexcept override;
+    };
+public:
+    ArithmeticSelectNodeForInteger(NodeHandle& node_P, NodeHandle& node_A, NodeHandle& node_B);
+    ~ArithmeticSelectNodeForInteger() override = default;
+    void generate_procedure() override;
+    void estimate_bound() noexcept override;
 };
 
 }
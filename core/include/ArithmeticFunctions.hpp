@@ -4,12 +4,44 @@
 #include <cstdint>
 #include <cstdlib>
 #include <algorithm>
+#include <bit>
+#include <type_traits>
+
+#include "VectorizedFunctions.hpp"
 
 namespace mpengine {
 
 using u64arr = uint64_t*;
 
-inline bool u64_variable_length_integer_addition_with_carry(const u64arr a, const u64arr b, u64arr c, const size_t length, const uint64_t base) noexcept {
+/**
+ * @brief Compile-time store base of a compact radix.
+ *
+ * The kernels taking a `base` are templates over its type: a runtime uint64_t, or CompactRadix<base>, which
+ * converts to the same value as a constant, so that the divisions by the base become multiplications by its
+ * reciprocal (decimal) or shifts and masks (binary). dispatch_radix passes the CompactRadix of the store base.
+ */
+
+template<uint64_t Base>
+using CompactRadix = std::integral_constant<uint64_t, Base>;
+
+inline size_t u64_variable_length_integer_significant_length(const u64arr a, size_t length) noexcept {
+    while (length > 0 && a[length - 1] == 0ull) {
+        length--;
+    }
+    return length;
+}
+
+template<typename Radix>
+inline bool u64_variable_length_integer_addition_with_carry(const u64arr a, const u64arr b, u64arr c, const size_t length, const Radix base) noexcept {
+#ifdef MPENGINE_SIMD_KERNELS_AVAILABLE
+    if (length >= simd_min_length) {
+        switch (simd_level()) {
+            case SIMDLevel::avx512: return u64_avx512_addition_with_carry(a, b, c, length, base);
+            case SIMDLevel::avx2: return u64_avx2_addition_with_carry(a, b, c, length, base);
+            default: break;
+        }
+    }
+#endif
     uint64_t carry = 0ull;
     for (size_t i = 0; i < length; i++) {
         c[i] = a[i] + b[i] + carry;
@@ -24,6 +56,15 @@ inline bool u64_variable_length_integer_addition_with_carry(const u64arr a, cons
 }
 
 inline int u64_variable_length_integer_compare(const u64arr a, const u64arr b, const size_t length) noexcept {
+#ifdef MPENGINE_SIMD_KERNELS_AVAILABLE
+    if (length >= simd_min_length) {
+        switch (simd_level()) {
+            case SIMDLevel::avx512: return u64_avx512_compare(a, b, length);
+            case SIMDLevel::avx2: return u64_avx2_compare(a, b, length);
+            default: break;
+        }
+    }
+#endif
     for (size_t i = length - 1; ; i--) {
         if (a[i] > b[i]) {
             return 1;
@@ -37,7 +78,17 @@ inline int u64_variable_length_integer_compare(const u64arr a, const u64arr b, c
     return 0;
 }
 
-inline bool u64_variable_length_integer_subtraction_with_carry_a_ge_b(const u64arr a, const u64arr b, u64arr c, const size_t length, const uint64_t base) noexcept {
+template<typename Radix>
+inline bool u64_variable_length_integer_subtraction_with_carry_a_ge_b(const u64arr a, const u64arr b, u64arr c, const size_t length, const Radix base) noexcept {
+#ifdef MPENGINE_SIMD_KERNELS_AVAILABLE
+    if (length >= simd_min_length) {
+        switch (simd_level()) {
+            case SIMDLevel::avx512: return u64_avx512_subtraction_with_carry(a, b, c, length, base);
+            case SIMDLevel::avx2: return u64_avx2_subtraction_with_carry(a, b, c, length, base);
+            default: break;
+        }
+    }
+#endif
     uint64_t carry = 0ull;
     for (size_t i = 0; i < length; i++) {
         if (a[i] >= b[i] + carry) {
@@ -51,7 +102,46 @@ inline bool u64_variable_length_integer_subtraction_with_carry_a_ge_b(const u64a
     return carry != 0ull;
 }
 
-inline bool u64_variable_length_integer_multiplication_c_2len_with_carry(const u64arr a, const u64arr b, u64arr c, const size_t length, const uint64_t base) noexcept {
+template<typename Radix>
+inline void u64_variable_length_integer_complement_in_place(u64arr c, const size_t length, const Radix base) noexcept {
+    //Computes c = base ^ length - c for a nonzero c (a zero c is left unchanged), which turns the wrapped difference a - b into b - a.
+    size_t i = 0;
+    while (i < length && c[i] == 0ull) {
+        i++;
+    }
+    if (i == length) {
+        return;
+    }
+    c[i] = base - c[i];
+    for (i++; i < length; i++) {
+        c[i] = base - 1 - c[i];
+    }
+    return;
+}
+
+inline void u64_variable_length_integer_raw_accumulation(u64arr c, const u64arr a, const size_t length) noexcept {
+    //Computes c[i] += a[i] without carries, the limbs of c grow by base - 1 at most per accumulated operand.
+    for (size_t i = 0; i < length; i++) {
+        c[i] += a[i];
+    }
+    return;
+}
+
+template<typename Radix>
+inline uint64_t u64_variable_length_integer_carry_normalization(u64arr c, const size_t length, const Radix base) noexcept {
+    /* Brings raw accumulated limbs back below base in a single carry pass. Returns the carry out of length limbs.
+       No limb may exceed UINT64_MAX - UINT64_MAX / base, which holds for up to UINT64_MAX / base accumulated operands. */
+    uint64_t carry = 0ull;
+    for (size_t i = 0; i < length; i++) {
+        const uint64_t total = c[i] + carry;
+        c[i] = total % base;
+        carry = total / base;
+    }
+    return carry;
+}
+
+template<typename Radix>
+inline bool u64_variable_length_integer_multiplication_c_2len_with_carry(const u64arr a, const u64arr b, u64arr c, const size_t length, const Radix base) noexcept {
     //Array c is guraranteed to be filled with zeros.
     for (size_t i = 0; i < length; i++) {
         uint64_t carry = 0ull;
@@ -70,4 +160,657 @@ inline bool u64_variable_length_integer_multiplication_c_2len_with_carry(const u
     return c[(length << 1) - 1] < base;
 }
 
+template<typename Radix>
+inline bool u64_variable_length_integer_addition_in_place(u64arr c, const u64arr a, const size_t length_c, const size_t length_a, const Radix base) noexcept {
+    //Computes c += a, where length_a <= length_c. The carry keeps propagating above length_a.
+    uint64_t carry = 0ull;
+    size_t i = 0;
+    for (; i < length_a; i++) {
+        c[i] = c[i] + a[i] + carry;
+        if (c[i] >= base) {
+            c[i] = c[i] - base;
+            carry = 1ull;
+        } else {
+            carry = 0ull;
+        }
+    }
+    for (; carry != 0ull && i < length_c; i++) {
+        c[i] = c[i] + carry;
+        if (c[i] >= base) {
+            c[i] = c[i] - base;
+        } else {
+            carry = 0ull;
+        }
+    }
+    return carry != 0ull;
+}
+
+template<typename Radix>
+inline bool u64_variable_length_integer_subtraction_in_place(u64arr c, const u64arr a, const size_t length_c, const size_t length_a, const Radix base) noexcept {
+    //Computes c -= a, where length_a <= length_c. Returns true if c < a (borrow out of the top limb).
+    uint64_t carry = 0ull;
+    size_t i = 0;
+    for (; i < length_a; i++) {
+        if (c[i] >= a[i] + carry) {
+            c[i] = c[i] - a[i] - carry;
+            carry = 0ull;
+        } else {
+            c[i] = c[i] + base - a[i] - carry;
+            carry = 1ull;
+        }
+    }
+    for (; carry != 0ull && i < length_c; i++) {
+        if (c[i] >= carry) {
+            c[i] = c[i] - carry;
+            carry = 0ull;
+        } else {
+            c[i] = c[i] + base - carry;
+        }
+    }
+    return carry != 0ull;
+}
+
+template<typename Radix>
+inline bool u64_variable_length_integer_addition_unbalanced(const u64arr a, const u64arr b, u64arr c, const size_t length_a, const size_t length_b, const Radix base) noexcept {
+    //Computes c = a + b over length_a limbs, where length_b <= length_a.
+    uint64_t carry = 0ull;
+    for (size_t i = 0; i < length_a; i++) {
+        c[i] = a[i] + (i < length_b ? b[i] : 0ull) + carry;
+        if (c[i] >= base) {
+            c[i] = c[i] - base;
+            carry = 1ull;
+        } else {
+            carry = 0ull;
+        }
+    }
+    return carry != 0ull;
+}
+
+template<typename Radix>
+inline void u64_variable_length_integer_schoolbook_multiplication(const u64arr a, const u64arr b, u64arr c, const size_t length_a, const size_t length_b, const Radix base) noexcept {
+    //Computes c = a * b, where c holds (length_a + length_b) limbs and is zeroed here.
+    std::fill(c, c + length_a + length_b, 0ull);
+    for (size_t i = 0; i < length_a; i++) {
+        if (a[i] == 0ull) {
+            continue;
+        }
+        uint64_t carry = 0ull;
+        for (size_t j = 0; j < length_b; j++) {
+            uint64_t total = c[i + j] + a[i] * b[j] + carry;
+            c[i + j] = total % base;
+            carry = total / base;
+        }
+        c[i + length_b] = carry;
+    }
+    return;
+}
+
+template<typename Radix>
+inline void u64_variable_length_integer_schoolbook_squaring(const u64arr a, u64arr c, const size_t length, const Radix base) noexcept {
+    /* Computes c = a * a, where c holds (length << 1) limbs and is zeroed here.
+       The products a[i] * a[j] (i < j) are accumulated once and doubled, then the squares a[i] * a[i] are added. */
+    std::fill(c, c + (length << 1), 0ull);
+    for (size_t i = 0; i + 1 < length; i++) {
+        if (a[i] == 0ull) {
+            continue;
+        }
+        uint64_t carry = 0ull;
+        for (size_t j = i + 1; j < length; j++) {
+            uint64_t total = c[i + j] + a[i] * a[j] + carry;
+            c[i + j] = total % base;
+            carry = total / base;
+        }
+        c[i + length] = carry;
+    }
+    uint64_t carry = 0ull;
+    for (size_t k = 0; k < (length << 1); k++) {
+        uint64_t total = (c[k] << 1) + carry + ((k & 1) == 0 ? a[k >> 1] * a[k >> 1] : 0ull);
+        c[k] = total % base;
+        carry = total / base;
+    }
+    return;
+}
+
+template<typename Radix>
+inline uint64_t u64_variable_length_integer_multiply_add_small(u64arr c, const u64arr a, const size_t length_c, const size_t length_a, const uint64_t m, const Radix base) noexcept {
+    //Computes c += a * m for a single-limb multiplier m (m * base must fit in 64 bits). Returns the carry out of length_c limbs.
+    uint64_t carry = 0ull;
+    size_t i = 0;
+    for (; i < length_a; i++) {
+        uint64_t total = c[i] + a[i] * m + carry;
+        c[i] = total % base;
+        carry = total / base;
+    }
+    for (; carry != 0ull && i < length_c; i++) {
+        uint64_t total = c[i] + carry;
+        c[i] = total % base;
+        carry = total / base;
+    }
+    return carry;
+}
+
+template<typename Radix>
+inline uint64_t u64_variable_length_integer_division_by_small(u64arr a, const size_t length, const uint64_t d, const Radix base) noexcept {
+    //Computes a /= d in place for a single-limb divisor d (d * base must fit in 64 bits). Returns the remainder.
+    uint64_t remainder = 0ull;
+    for (size_t i = length; i-- > 0; ) {
+        uint64_t total = remainder * base + a[i];
+        a[i] = total / d;
+        remainder = total % d;
+    }
+    return remainder;
+}
+
+/**
+ * @struct NativeRadix
+ * @brief Tag selecting the full 2 ^ 64 limb radix.
+ *
+ * Every kernel taking a runtime `base` has an overload taking NativeRadix instead, in which the carries
+ * are the hardware carry flag (`_addcarry_u64` / `_subborrow_u64`) and the limb products are 128-bit.
+ * The higher level kernels are templates over the radix, so `Radix` is uint64_t, a CompactRadix, NativeRadix or WideRadix.
+ */
+
+struct NativeRadix {};
+
+inline unsigned char u64_native_add_with_carry(const unsigned char carry, const uint64_t a, const uint64_t b, uint64_t& c) noexcept {
+#if defined(__x86_64__)
+    unsigned long long result;
+    const unsigned char carry_out = _addcarry_u64(carry, a, b, &result);
+    c = result;
+    return carry_out;
+#else
+    const uint64_t partial = a + b, total = partial + carry;
+    c = total;
+    return static_cast<unsigned char>((partial < a) | (total < partial));
+#endif
+}
+
+inline unsigned char u64_native_sub_with_borrow(const unsigned char borrow, const uint64_t a, const uint64_t b, uint64_t& c) noexcept {
+#if defined(__x86_64__)
+    unsigned long long result;
+    const unsigned char borrow_out = _subborrow_u64(borrow, a, b, &result);
+    c = result;
+    return borrow_out;
+#else
+    const uint64_t partial = a - b, total = partial - borrow;
+    c = total;
+    return static_cast<unsigned char>((a < b) | (partial < borrow));
+#endif
+}
+
+inline bool u64_variable_length_integer_addition_with_carry(const u64arr a, const u64arr b, u64arr c, const size_t length, NativeRadix) noexcept {
+    unsigned char carry = 0;
+    for (size_t i = 0; i < length; i++) {
+        carry = u64_native_add_with_carry(carry, a[i], b[i], c[i]);
+    }
+    return carry != 0;
+}
+
+inline bool u64_variable_length_integer_subtraction_with_carry_a_ge_b(const u64arr a, const u64arr b, u64arr c, const size_t length, NativeRadix) noexcept {
+    unsigned char borrow = 0;
+    for (size_t i = 0; i < length; i++) {
+        borrow = u64_native_sub_with_borrow(borrow, a[i], b[i], c[i]);
+    }
+    return borrow != 0;
+}
+
+inline void u64_variable_length_integer_complement_in_place(u64arr c, const size_t length, NativeRadix) noexcept {
+    size_t i = 0;
+    while (i < length && c[i] == 0ull) {
+        i++;
+    }
+    if (i == length) {
+        return;
+    }
+    c[i] = 0ull - c[i];
+    for (i++; i < length; i++) {
+        c[i] = ~c[i];
+    }
+    return;
+}
+
+inline bool u64_variable_length_integer_addition_in_place(u64arr c, const u64arr a, const size_t length_c, const size_t length_a, NativeRadix) noexcept {
+    unsigned char carry = 0;
+    size_t i = 0;
+    for (; i < length_a; i++) {
+        carry = u64_native_add_with_carry(carry, c[i], a[i], c[i]);
+    }
+    for (; carry != 0 && i < length_c; i++) {
+        carry = u64_native_add_with_carry(carry, c[i], 0ull, c[i]);
+    }
+    return carry != 0;
+}
+
+inline bool u64_variable_length_integer_subtraction_in_place(u64arr c, const u64arr a, const size_t length_c, const size_t length_a, NativeRadix) noexcept {
+    unsigned char borrow = 0;
+    size_t i = 0;
+    for (; i < length_a; i++) {
+        borrow = u64_native_sub_with_borrow(borrow, c[i], a[i], c[i]);
+    }
+    for (; borrow != 0 && i < length_c; i++) {
+        borrow = u64_native_sub_with_borrow(borrow, c[i], 0ull, c[i]);
+    }
+    return borrow != 0;
+}
+
+inline bool u64_variable_length_integer_addition_unbalanced(const u64arr a, const u64arr b, u64arr c, const size_t length_a, const size_t length_b, NativeRadix) noexcept {
+    unsigned char carry = 0;
+    size_t i = 0;
+    for (; i < length_b; i++) {
+        carry = u64_native_add_with_carry(carry, a[i], b[i], c[i]);
+    }
+    for (; i < length_a; i++) {
+        carry = u64_native_add_with_carry(carry, a[i], 0ull, c[i]);
+    }
+    return carry != 0;
+}
+
+inline void u64_variable_length_integer_schoolbook_multiplication(const u64arr a, const u64arr b, u64arr c, const size_t length_a, const size_t length_b, NativeRadix) noexcept {
+    //c[i + j] + a[i] * b[j] + carry never exceeds 2 ^ 128 - 1.
+    std::fill(c, c + length_a + length_b, 0ull);
+    for (size_t i = 0; i < length_a; i++) {
+        if (a[i] == 0ull) {
+            continue;
+        }
+        uint64_t carry = 0ull;
+        for (size_t j = 0; j < length_b; j++) {
+            const unsigned __int128 total = static_cast<unsigned __int128>(a[i]) * b[j] + c[i + j] + carry;
+            c[i + j] = static_cast<uint64_t>(total);
+            carry = static_cast<uint64_t>(total >> 64);
+        }
+        c[i + length_b] = carry;
+    }
+    return;
+}
+
+inline void u64_variable_length_integer_schoolbook_squaring(const u64arr a, u64arr c, const size_t length, NativeRadix) noexcept {
+    std::fill(c, c + (length << 1), 0ull);
+    for (size_t i = 0; i + 1 < length; i++) {
+        if (a[i] == 0ull) {
+            continue;
+        }
+        uint64_t carry = 0ull;
+        for (size_t j = i + 1; j < length; j++) {
+            const unsigned __int128 total = static_cast<unsigned __int128>(a[i]) * a[j] + c[i + j] + carry;
+            c[i + j] = static_cast<uint64_t>(total);
+            carry = static_cast<uint64_t>(total >> 64);
+        }
+        c[i + length] = carry;
+    }
+    //Doubling and the diagonal squares in one pass, the carry never exceeds 2.
+    uint64_t carry = 0ull;
+    for (size_t i = 0; i < length; i++) {
+        const unsigned __int128 square = static_cast<unsigned __int128>(a[i]) * a[i];
+        unsigned __int128 total = (static_cast<unsigned __int128>(c[i << 1]) << 1) + static_cast<uint64_t>(square) + carry;
+        c[i << 1] = static_cast<uint64_t>(total);
+        total = (static_cast<unsigned __int128>(c[(i << 1) + 1]) << 1) + static_cast<uint64_t>(square >> 64) + static_cast<uint64_t>(total >> 64);
+        c[(i << 1) + 1] = static_cast<uint64_t>(total);
+        carry = static_cast<uint64_t>(total >> 64);
+    }
+    return;
+}
+
+inline uint64_t u64_variable_length_integer_multiply_add_small(u64arr c, const u64arr a, const size_t length_c, const size_t length_a, const uint64_t m, NativeRadix) noexcept {
+    uint64_t carry = 0ull;
+    size_t i = 0;
+    for (; i < length_a; i++) {
+        const unsigned __int128 total = static_cast<unsigned __int128>(a[i]) * m + c[i] + carry;
+        c[i] = static_cast<uint64_t>(total);
+        carry = static_cast<uint64_t>(total >> 64);
+    }
+    for (; carry != 0ull && i < length_c; i++) {
+        carry = u64_native_add_with_carry(0, c[i], carry, c[i]);
+    }
+    return carry;
+}
+
+inline uint64_t u64_variable_length_integer_division_by_small(u64arr a, const size_t length, const uint64_t d, NativeRadix) noexcept {
+    uint64_t remainder = 0ull;
+    for (size_t i = length; i-- > 0; ) {
+        const unsigned __int128 total = (static_cast<unsigned __int128>(remainder) << 64) | a[i];
+        a[i] = static_cast<uint64_t>(total / d);
+        remainder = static_cast<uint64_t>(total % d);
+    }
+    return remainder;
+}
+
+inline uint64_t u64_native_divide_with_remainder(const uint64_t high, const uint64_t low, const uint64_t d, uint64_t& r) noexcept {
+    //Divides high * 2 ^ 64 + low by d, where high < d so that the quotient fits in 64 bits.
+#if defined(__x86_64__)
+    uint64_t q;
+    __asm__("divq %4" : "=a"(q), "=d"(r) : "a"(low), "d"(high), "rm"(d));
+    return q;
+#else
+    const unsigned __int128 total = (static_cast<unsigned __int128>(high) << 64) | low;
+    r = static_cast<uint64_t>(total % d);
+    return static_cast<uint64_t>(total / d);
+#endif
+}
+
+/**
+ * Scalar kernels by a full 64-bit word s, one linear pass each. c may alias a.
+ * In the compact radices the word may exceed the store base, the products and partial dividends are then
+ * 128-bit and divided by a single hardware division, since their high word is below the divisor.
+ */
+
+template<typename Radix>
+inline uint64_t u64_variable_length_integer_scalar_multiplication(const u64arr a, u64arr c, const size_t length, const uint64_t s, const Radix base) noexcept {
+    //Computes c = a * s, returns the carry out of the top limb (the product overflows if it is nonzero).
+    uint64_t carry = 0ull;
+    if (s <= UINT64_MAX / base) {
+        for (size_t i = 0; i < length; i++) {
+            const uint64_t total = a[i] * s + carry;
+            c[i] = total % base;
+            carry = total / base;
+        }
+        return carry;
+    }
+    for (size_t i = 0; i < length; i++) {
+        const unsigned __int128 total = static_cast<unsigned __int128>(a[i]) * s + carry;
+        uint64_t limb;
+        carry = u64_native_divide_with_remainder(static_cast<uint64_t>(total >> 64), static_cast<uint64_t>(total), base, limb);
+        c[i] = limb;
+    }
+    return carry;
+}
+
+template<typename Radix>
+inline uint64_t u64_variable_length_integer_scalar_division(const u64arr a, u64arr c, const size_t length, const uint64_t d, const Radix base) noexcept {
+    //Computes c = a / d for a nonzero d, returns the remainder.
+    uint64_t remainder = 0ull;
+    if (d <= UINT64_MAX / base) {
+        for (size_t i = length; i-- > 0; ) {
+            const uint64_t total = remainder * base + a[i];
+            c[i] = total / d;
+            remainder = total % d;
+        }
+        return remainder;
+    }
+    for (size_t i = length; i-- > 0; ) {
+        const unsigned __int128 total = static_cast<unsigned __int128>(remainder) * base + a[i];
+        c[i] = u64_native_divide_with_remainder(static_cast<uint64_t>(total >> 64), static_cast<uint64_t>(total), d, remainder);
+    }
+    return remainder;
+}
+
+template<typename Radix>
+inline uint64_t u64_variable_length_integer_scalar_modulo(const u64arr a, const size_t length, const uint64_t d, const Radix base) noexcept {
+    //Computes a mod d for a nonzero d without writing a quotient.
+    uint64_t remainder = 0ull;
+    if (d <= UINT64_MAX / base) {
+        for (size_t i = length; i-- > 0; ) {
+            remainder = (remainder * base + a[i]) % d;
+        }
+        return remainder;
+    }
+    for (size_t i = length; i-- > 0; ) {
+        const unsigned __int128 total = static_cast<unsigned __int128>(remainder) * base + a[i];
+        u64_native_divide_with_remainder(static_cast<uint64_t>(total >> 64), static_cast<uint64_t>(total), d, remainder);
+    }
+    return remainder;
+}
+
+template<typename Radix>
+inline void u64_variable_length_integer_assign_word(u64arr c, const size_t length, uint64_t word, const Radix base) noexcept {
+    //Writes the limbs of a single word into c (at most 3 limbs for the compact radices) and zeros the rest.
+    std::fill(c, c + length, 0ull);
+    for (size_t i = 0; i < length && word != 0ull; i++, word /= base) {
+        c[i] = word % base;
+    }
+    return;
+}
+
+inline uint64_t u64_variable_length_integer_scalar_multiplication(const u64arr a, u64arr c, const size_t length, const uint64_t s, NativeRadix) noexcept {
+    uint64_t carry = 0ull;
+    for (size_t i = 0; i < length; i++) {
+        const unsigned __int128 total = static_cast<unsigned __int128>(a[i]) * s + carry;
+        c[i] = static_cast<uint64_t>(total);
+        carry = static_cast<uint64_t>(total >> 64);
+    }
+    return carry;
+}
+
+inline uint64_t u64_variable_length_integer_scalar_division(const u64arr a, u64arr c, const size_t length, const uint64_t d, NativeRadix) noexcept {
+    uint64_t remainder = 0ull;
+    for (size_t i = length; i-- > 0; ) {
+        c[i] = u64_native_divide_with_remainder(remainder, a[i], d, remainder);
+    }
+    return remainder;
+}
+
+inline uint64_t u64_variable_length_integer_scalar_modulo(const u64arr a, const size_t length, const uint64_t d, NativeRadix) noexcept {
+    uint64_t remainder = 0ull;
+    for (size_t i = length; i-- > 0; ) {
+        u64_native_divide_with_remainder(remainder, a[i], d, remainder);
+    }
+    return remainder;
+}
+
+inline void u64_variable_length_integer_assign_word(u64arr c, const size_t length, const uint64_t word, NativeRadix) noexcept {
+    std::fill(c, c + length, 0ull);
+    if (length > 0) {
+        c[0] = word;
+    }
+    return;
+}
+
+constexpr unsigned __int128 u64_radix_value(const uint64_t base) noexcept {
+    return base;
+}
+
+constexpr unsigned __int128 u64_radix_value(NativeRadix) noexcept {
+    return static_cast<unsigned __int128>(1) << 64;
+}
+
+/**
+ * @struct WideRadix
+ * @brief Compile-time store base of the wide radix: 10 ^ 18 or 2 ^ 60, the square of a 30-bit piece base.
+ *
+ * A wide decimal limb holds 18 digits instead of the 8 of a compact one, so every kernel touches 2.25 times
+ * fewer limbs, and a limb still prints as a fixed-width chunk of io digits. The sum of two wide limbs stays
+ * far below 2 ^ 64, so the additive kernels are the compact ones; the kernels multiplying two limbs have
+ * overloads taking WideRadix, where the products are 128-bit and split at the base by U128ConstantSplit.
+ */
+
+constexpr uint64_t u64_wide_piece_base(const uint64_t base) noexcept {
+    //The integer square root of the base.
+    uint64_t low = 1ull, high = 1ull << 32;
+    while (low < high) {
+        const uint64_t middle = (low + high) >> 1;
+        if (middle * middle < base) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+    return low;
+}
+
+template<uint64_t Base>
+struct WideRadix: std::integral_constant<uint64_t, Base> {
+    static constexpr uint64_t piece = u64_wide_piece_base(Base);
+    static_assert(piece * piece == Base && Base <= (1ull << 60), "A wide store base is the square of a piece base, at most 2 ^ 60.");
+};
+
+template<typename Radix>
+inline constexpr bool u64_is_wide_radix_v = false;
+
+template<uint64_t Base>
+inline constexpr bool u64_is_wide_radix_v<WideRadix<Base>> = true;
+
+template<uint64_t Base>
+struct U128ConstantSplit {
+    /* Divides a 128-bit x < Base * 2 ^ 64 by the constant Base (Moller and Granlund): the divisor is normalized to its
+       top bit, and the quotient estimated from the precomputed reciprocal is off by one at most, which a single
+       comparison and a single adjustment correct. Two multiplications instead of a hardware division. */
+    static constexpr int shift = std::countl_zero(Base);
+    static constexpr uint64_t divisor = Base << shift;
+    static constexpr uint64_t reciprocal = static_cast<uint64_t>(~static_cast<unsigned __int128>(0) / divisor);
+    static uint64_t divide(const unsigned __int128 x, uint64_t& remainder) noexcept {
+        const unsigned __int128 normalized = x << shift;
+        const uint64_t high = static_cast<uint64_t>(normalized >> 64), low = static_cast<uint64_t>(normalized);
+        const unsigned __int128 estimate = static_cast<unsigned __int128>(reciprocal) * high + normalized + (static_cast<unsigned __int128>(1) << 64);
+        uint64_t quotient = static_cast<uint64_t>(estimate >> 64), rest = low - quotient * divisor;
+        if (rest > static_cast<uint64_t>(estimate)) {
+            quotient--;
+            rest += divisor;
+        }
+        if (rest >= divisor) {
+            quotient++;
+            rest -= divisor;
+        }
+        remainder = rest >> shift;
+        return quotient;
+    }
+};
+
+template<uint64_t Base>
+inline void u64_variable_length_integer_schoolbook_multiplication(const u64arr a, const u64arr b, u64arr c, const size_t length_a, const size_t length_b, WideRadix<Base>) noexcept {
+    //c[i + j] + a[i] * b[j] + carry stays below Base * 2 ^ 64.
+    std::fill(c, c + length_a + length_b, 0ull);
+    for (size_t i = 0; i < length_a; i++) {
+        if (a[i] == 0ull) {
+            continue;
+        }
+        uint64_t carry = 0ull;
+        for (size_t j = 0; j < length_b; j++) {
+            carry = U128ConstantSplit<Base>::divide(static_cast<unsigned __int128>(a[i]) * b[j] + c[i + j] + carry, c[i + j]);
+        }
+        c[i + length_b] = carry;
+    }
+    return;
+}
+
+template<uint64_t Base>
+inline void u64_variable_length_integer_schoolbook_squaring(const u64arr a, u64arr c, const size_t length, WideRadix<Base>) noexcept {
+    std::fill(c, c + (length << 1), 0ull);
+    for (size_t i = 0; i + 1 < length; i++) {
+        if (a[i] == 0ull) {
+            continue;
+        }
+        uint64_t carry = 0ull;
+        for (size_t j = i + 1; j < length; j++) {
+            carry = U128ConstantSplit<Base>::divide(static_cast<unsigned __int128>(a[i]) * a[j] + c[i + j] + carry, c[i + j]);
+        }
+        c[i + length] = carry;
+    }
+    uint64_t carry = 0ull;
+    for (size_t k = 0; k < (length << 1); k++) {
+        const unsigned __int128 square = (k & 1) == 0 ? static_cast<unsigned __int128>(a[k >> 1]) * a[k >> 1] : 0;
+        carry = U128ConstantSplit<Base>::divide(square + (c[k] << 1) + carry, c[k]);
+    }
+    return;
+}
+
+template<uint64_t Base>
+inline uint64_t u64_variable_length_integer_multiply_add_small(u64arr c, const u64arr a, const size_t length_c, const size_t length_a, const uint64_t m, WideRadix<Base>) noexcept {
+    //Any word m below 2 ^ 64 - 1, the carries stay below m + 2.
+    uint64_t carry = 0ull;
+    size_t i = 0;
+    for (; i < length_a; i++) {
+        carry = U128ConstantSplit<Base>::divide(static_cast<unsigned __int128>(a[i]) * m + c[i] + carry, c[i]);
+    }
+    for (; carry != 0ull && i < length_c; i++) {
+        carry = U128ConstantSplit<Base>::divide(static_cast<unsigned __int128>(c[i]) + carry, c[i]);
+    }
+    return carry;
+}
+
+template<uint64_t Base>
+inline uint64_t u64_variable_length_integer_division_by_small(u64arr a, const size_t length, const uint64_t d, WideRadix<Base>) noexcept {
+    //remainder * Base + a[i] is below d * 2 ^ 64, one hardware division per limb.
+    uint64_t remainder = 0ull;
+    for (size_t i = length; i-- > 0; ) {
+        const unsigned __int128 total = static_cast<unsigned __int128>(remainder) * Base + a[i];
+        a[i] = u64_native_divide_with_remainder(static_cast<uint64_t>(total >> 64), static_cast<uint64_t>(total), d, remainder);
+    }
+    return remainder;
+}
+
+template<typename Radix>
+inline void u64_variable_length_integer_signed_addition_in_place(u64arr c, bool& sign_c, const u64arr a, const bool sign_a, const size_t length, const Radix base) noexcept {
+    //Computes (sign_c, c) += (sign_a, a) on sign-magnitude values, where true stands for the positive sign.
+    if (sign_c == sign_a) {
+        u64_variable_length_integer_addition_in_place(c, a, length, length, base);
+    } else if (u64_variable_length_integer_compare(c, a, length) >= 0) {
+        u64_variable_length_integer_subtraction_in_place(c, a, length, length, base);
+    } else {
+        u64_variable_length_integer_subtraction_with_carry_a_ge_b(a, c, c, length, base);
+        sign_c = sign_a;
+    }
+    return;
+}
+
+constexpr size_t u64_karatsuba_scratch_length(size_t length, size_t threshold) noexcept {
+    //Scratch limbs required by u64_variable_length_integer_karatsuba_multiplication.
+    size_t total = 0;
+    threshold = std::max<size_t>(threshold, 1);
+    while (length > threshold) {
+        size_t half = (length + 1) >> 1;
+        total += (half << 2) + 1;
+        length = half;
+    }
+    return total;
+}
+
+template<typename Radix>
+inline void u64_karatsuba_merge(u64arr c, u64arr z1, const u64arr sa, const u64arr sb, const bool carry_a, const bool carry_b, const size_t half, const size_t length, const Radix base) noexcept {
+    /* On entry c[0, 2 * half) holds z0 = a0 * b0, c[2 * half, 2 * length) holds z2 = a1 * b1,
+       and z1[0, 2 * half) holds sa * sb where (a0 + a1) = sa + carry_a * base ^ half (same for b).
+       Restores the middle product (a0 + a1) * (b0 + b1) - z0 - z2 in z1 and adds it to c at offset half. */
+    const size_t rest = length - half;
+    z1[half << 1] = 0ull;
+    if (carry_a) {
+        u64_variable_length_integer_addition_in_place(z1 + half, sb, half + 1, half, base);
+    }
+    if (carry_b) {
+        u64_variable_length_integer_addition_in_place(z1 + half, sa, half + 1, half, base);
+    }
+    if (carry_a && carry_b) {
+        z1[half << 1] += 1ull;
+    }
+    u64_variable_length_integer_subtraction_in_place(z1, c, (half << 1) + 1, half << 1, base);
+    u64_variable_length_integer_subtraction_in_place(z1, c + (half << 1), (half << 1) + 1, rest << 1, base);
+    const size_t span = std::min<size_t>((half << 1) + 1, (length << 1) - half);
+    u64_variable_length_integer_addition_in_place(c + half, z1, (length << 1) - half, span, base);
+    return;
+}
+
+template<typename Radix>
+inline void u64_variable_length_integer_karatsuba_multiplication(const u64arr a, const u64arr b, u64arr c, const size_t length, const Radix base, u64arr scratch, const size_t threshold) noexcept {
+    /* Computes c = a * b, where a and b hold length limbs and c holds (length << 1) limbs.
+       Scratch must provide at least u64_karatsuba_scratch_length(length, threshold) limbs. */
+    if (length <= std::max<size_t>(threshold, 1)) {
+        u64_variable_length_integer_schoolbook_multiplication(a, b, c, length, length, base);
+        return;
+    }
+    const size_t half = (length + 1) >> 1, rest = length - half;
+    u64arr sa = scratch, sb = scratch + half, z1 = scratch + (half << 1), next = scratch + (half << 2) + 1;
+    u64_variable_length_integer_karatsuba_multiplication(a, b, c, half, base, next, threshold);
+    u64_variable_length_integer_karatsuba_multiplication(a + half, b + half, c + (half << 1), rest, base, next, threshold);
+    const bool carry_a = u64_variable_length_integer_addition_unbalanced(a, a + half, sa, half, rest, base);
+    const bool carry_b = u64_variable_length_integer_addition_unbalanced(b, b + half, sb, half, rest, base);
+    u64_variable_length_integer_karatsuba_multiplication(sa, sb, z1, half, base, next, threshold);
+    u64_karatsuba_merge(c, z1, sa, sb, carry_a, carry_b, half, length, base);
+    return;
+}
+
+template<typename Radix>
+inline void u64_variable_length_integer_karatsuba_squaring(const u64arr a, u64arr c, const size_t length, const Radix base, u64arr scratch, const size_t threshold) noexcept {
+    /* Computes c = a * a with three half-length squarings, the middle one of (a0 + a1).
+       Scratch must provide at least u64_karatsuba_scratch_length(length, threshold) limbs. */
+    if (length <= std::max<size_t>(threshold, 1)) {
+        u64_variable_length_integer_schoolbook_squaring(a, c, length, base);
+        return;
+    }
+    const size_t half = (length + 1) >> 1, rest = length - half;
+    u64arr sa = scratch, z1 = scratch + (half << 1), next = scratch + (half << 2) + 1;
+    u64_variable_length_integer_karatsuba_squaring(a, c, half, base, next, threshold);
+    u64_variable_length_integer_karatsuba_squaring(a + half, c + (half << 1), rest, base, next, threshold);
+    const bool carry_a = u64_variable_length_integer_addition_unbalanced(a, a + half, sa, half, rest, base);
+    u64_variable_length_integer_karatsuba_squaring(sa, z1, half, base, next, threshold);
+    u64_karatsuba_merge(c, z1, sa, sa, carry_a, carry_a, half, length, base);
+    return;
+}
+
 }
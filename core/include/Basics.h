@@ -2,6 +2,7 @@
 
 #include <list>
 #include <latch>
+#include <mutex>
 #include <iomanip>
 #include <string.h>
 
@@ -28,6 +29,9 @@ inline constexpr const bool thread_binding_optimization = false;
  *
  * This class implements a variable-length integer type that:
  * - Uses a large base (100000000) for efficient storage
+ * - Optionally uses native 2 ^ 64 limbs (StoreRadix::native), converted from/to the io base only while parsing and printing
+ * - Optionally uses wide limbs of 10 ^ 18 or 2 ^ 60 (StoreRadix::wide), which print as fixed-width chunks as the compact ones
+ * - Optionally holds the compact limbs of an integer at rest as 32-bit limbs (see pack()), computing always uses 64-bit limbs
  * - Dynamically allocates memory from a global memory pool
  * - Automatically manages memory lifecycle
  * - Provides direct pointer access for high performance
@@ -59,14 +63,67 @@ struct BasicIntegerType {
     size_t log_len, len;
     BlockHandle data;
     IOBasic iobasic;
-    BasicIntegerType(size_t log_len, IOBasic iobasic);
+    StoreRadix radix;
+    //The limbs from used_len on are zeros. The kernels writing the limbs keep it up to date as a bound (len when unknown),
+    //so that the consumers work on O(used_len) limbs instead of the whole capacity.
+    size_t used_len;
+    //The used limbs as uint32_t while the integer is packed (data is null then), allocate() widens them back.
+    //The first consuming task to allocate widens them under widening_lock, packed_flag tells the others it is done.
+    BlockHandle packed;
+    std::atomic<bool> packed_flag;
+    std::mutex widening_lock;
+    //The views of this integer, which may share its block.
+    std::atomic<size_t> views;
+    BasicIntegerType(size_t log_len, IOBasic iobasic, StoreRadix radix = StoreRadix::compact);
     virtual ~BasicIntegerType();
     virtual void allocate();
+    //Narrows the limbs of an integer at rest into packed, with packed_limbs (compact radices, no views).
+    virtual void pack();
+    //Widens the packed limbs back into a block of its own, once for all of the consumers.
+    void widen();
+    //Grows the capacity to 2 ^ log_len limbs, an allocated block is replaced by a larger one holding the same used limbs.
+    virtual void resize(size_t log_len);
     ElementType* get_pointer() const noexcept;
     ElementType* get_ensured_pointer();
     const char* get_status() const noexcept;
 };
 
+/**
+ * @class BasicIntegerView
+ * @brief An integer sharing the limbs of a source integer, with a sign of its own.
+ *
+ * The limb block of the source is bound on allocation instead of a block of its own, so a view costs
+ * no copy. The view keeps its source alive and never releases the shared block. No kernel may write
+ * into the limbs of a view, only its sign is its own.
+ */
+
+struct BasicIntegerView: public BasicIntegerType {
+    std::shared_ptr<BasicIntegerType> source;
+    BasicIntegerView(const std::shared_ptr<BasicIntegerType>& source);
+    ~BasicIntegerView() override;
+    void allocate() override;
+    void resize(size_t log_len) override;
+    //The block belongs to the source.
+    void pack() override;
+};
+
+/**
+ * @class BasicIntegerSelection
+ * @brief A view of one of two source integers, the choice is made at run time.
+ *
+ * Both candidates count the selection among their views until choose() binds one of them as the source
+ * and drops the other, so the selected limbs are forwarded without a copy, just as a BasicIntegerView.
+ */
+
+struct BasicIntegerSelection: public BasicIntegerView {
+    std::shared_ptr<BasicIntegerType> alternative;
+    BasicIntegerSelection(const std::shared_ptr<BasicIntegerType>& source, const std::shared_ptr<BasicIntegerType>& alternative);
+    ~BasicIntegerSelection() override;
+    void resize(size_t log_len) override;
+    //Keeps the source, or the alternative which becomes the source then. Must precede the first allocation.
+    void choose(bool alternative_chosen);
+};
+
 /**
  * @class BasicComputeUnitType
  * @brief Base class for DAG-based multi-threaded task scheduling units.
@@ -97,6 +154,10 @@ struct BasicComputeUnitType {
     using FuncList = std::vector<std::function<void(int)>>;
     static constexpr const int DEFAULT_SIGNAL = 0;
     static constexpr const int SERIALIZE_SIGNAL = 1;
+    //Serialized successors run inline on the forwarding thread up to this depth, deeper ones are submitted,
+    //so that a long dependent chain does not exhaust the stack of a single thread.
+    static constexpr const size_t MAX_SERIALIZE_DEPTH = 256;
+    static thread_local size_t serialize_depth;
     FuncList forward_calls;
 #ifdef MPENGINE_STORE_PROCEDURE_DETAILS
     using DetaList = std::vector<std::string>;
@@ -238,6 +299,7 @@ struct ParallelizableUnit: public BasicComputeUnitType {
  *
  * @warning When MPENGINE_THREAD_BINDING_OPTIMIZATION is enabled, tasks execute
  *          directly on the calling thread which may increase call stack pressure.
+ *          The inline depth is bounded by MAX_SERIALIZE_DEPTH, deeper tasks are submitted instead.
  */
 
 template<typename DependencySynchronizerType> 
@@ -253,8 +315,15 @@ struct MonoUnit: public BasicComputeUnitType {
     void dependency_notice(int signal) override {
         try {
             if (dependency_synchronizer.ready()) {
-                if (signal == SERIALIZE_SIGNAL && thread_binding_optimization) {
-                    task->run();
+                if (signal == SERIALIZE_SIGNAL && thread_binding_optimization && serialize_depth < MAX_SERIALIZE_DEPTH) {
+                    serialize_depth++;
+                    try {
+                        task->run();
+                    } catch (...) {
+                        serialize_depth--;
+                        throw;
+                    }
+                    serialize_depth--;
                 } else {
                     putils::ThreadPool::get_global_threadpool().submit(task);
                 }
@@ -367,7 +436,8 @@ inline void add_dependency(std::latch& synchronizer, BasicComputeUnitType& prede
 inline void add_dependency(std::atomic<size_t>& synchronizer, std::mutex& cv_lock, std::condition_variable& cv_block_main, BasicComputeUnitType& predecessor) noexcept {
     predecessor.forward_calls.emplace_back([&synchronizer, &cv_lock, &cv_block_main] (int signal) {
         if (synchronizer.fetch_sub(1, std::memory_order_acq_rel) == 1) {
-            // std::unique_lock<std::mutex> lock(cv_lock);
+            //Notifies under the lock, the main thread may have checked the counter but not be waiting yet.
+            std::unique_lock<std::mutex> lock(cv_lock);
             cv_block_main.notify_all();
         }
     });
@@ -418,6 +488,8 @@ struct BasicNodeType {
     DataPtr data;
     NodePtrList nexts;
     Procedure procedure;
+    //Upper bound of the used limbs of the result, see estimate_bound().
+    size_t bound;
     BasicNodeType();
     virtual ~BasicNodeType();
     BasicNodeType(const BasicNodeType&) = default;
@@ -426,25 +498,45 @@ struct BasicNodeType {
     BasicNodeType& operator = (BasicNodeType&&) = default;
     virtual void generate_procedure();
     virtual BasicComputeUnitType& get_procedure_port();
+    //Redirects the operands pointing to node to replacement, when a graph rewrite replaces node.
+    virtual void replace_operand(NodePtr node, NodePtr replacement) noexcept;
+    //Derives bound from the bounds of the operands, which are estimated first. Defaults to the capacity.
+    virtual void estimate_bound() noexcept;
 };
 
 struct BasicTransformation: public BasicNodeType {
     NodePtr operand;
     BasicTransformation();
     ~BasicTransformation() override;
+    void replace_operand(NodePtr node, NodePtr replacement) noexcept override;
+    //The result is no longer than the operand, unless overridden.
+    void estimate_bound() noexcept override;
 };
 
 struct BasicBinaryOperation: public BasicNodeType {
     NodePtr operand_A, operand_B;
     BasicBinaryOperation();
     ~BasicBinaryOperation() override;
+    void replace_operand(NodePtr node, NodePtr replacement) noexcept override;
+    //The result is no longer than the longer operand, unless overridden.
+    void estimate_bound() noexcept override;
+};
+
+struct BasicTernaryOperation: public BasicNodeType {
+    NodePtr operand_A, operand_B, operand_C;
+    BasicTernaryOperation();
+    ~BasicTernaryOperation() override;
+    void replace_operand(NodePtr node, NodePtr replacement) noexcept override;
+    //The result is no longer than the longest operand, unless overridden.
+    void estimate_bound() noexcept override;
 };
 
 struct ConstantNode: public BasicNodeType {
-    ConstantNode(size_t log_len, IOBasic iobasic);
+    ConstantNode(size_t log_len, IOBasic iobasic, StoreRadix radix = StoreRadix::compact);
     ConstantNode(const BasicNodeType& node);
     ~ConstantNode() override;
     void generate_procedure() override;
+    void estimate_bound() noexcept override;
 };
 
 void parse_string_to_integer(std::string_view integer_view, BasicIntegerType& data);
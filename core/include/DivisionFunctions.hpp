@@ -0,0 +1,232 @@
+#pragma once
+
+#include <vector>
+#include <algorithm>
+#include <bit>
+
+#include "ArithmeticFunctions.hpp"
+#include "NTTFunctions.hpp"
+
+namespace mpengine {
+
+inline int u64_variable_length_integer_compare_unbalanced(const u64arr a, const size_t length_a, const u64arr b, const size_t length_b) noexcept {
+    //Compares integers of different lengths, the limbs beyond the length of each operand are zeros.
+    const size_t significant_a = u64_variable_length_integer_significant_length(a, length_a);
+    const size_t significant_b = u64_variable_length_integer_significant_length(b, length_b);
+    if (significant_a != significant_b) {
+        return significant_a > significant_b ? 1 : -1;
+    }
+    return significant_a == 0 ? 0 : u64_variable_length_integer_compare(a, b, significant_a);
+}
+
+template<typename Radix>
+inline void u64_variable_length_integer_unbalanced_multiplication(const u64arr a, const u64arr b, u64arr c, const size_t length_a, const size_t length_b, const Radix base, const size_t karatsuba_threshold, const size_t ntt_threshold) {
+    /* Computes c = a * b, where c holds (length_a + length_b) limbs.
+       The longer operand is cut into blocks of the shorter length, every block product is a balanced
+       Karatsuba product (or an NTT product from ntt_threshold limbs) accumulated into c. */
+    if (length_a < length_b) {
+        u64_variable_length_integer_unbalanced_multiplication(b, a, c, length_b, length_a, base, karatsuba_threshold, ntt_threshold);
+        return;
+    }
+    const size_t length = length_a + length_b;
+    std::fill(c, c + length, 0ull);
+    if (length_b == 0) {
+        return;
+    }
+    if (length_b <= std::max<size_t>(karatsuba_threshold, 1)) {
+        if (a == b && length_a == length_b) {
+            u64_variable_length_integer_schoolbook_squaring(a, c, length_a, base);
+            return;
+        }
+        u64_variable_length_integer_schoolbook_multiplication(a, b, c, length_a, length_b, base);
+        return;
+    }
+    constexpr size_t pieces = u64_ntt_pieces_v<Radix>;
+    const bool ntt = length_b >= ntt_threshold && std::bit_ceil((length_b << 1) * pieces) <= (1ull << ntt_max_log_length);
+    if (a == b && length_a == length_b) {
+        //Squares skip the blocks and take the squaring kernels.
+        if (ntt) {
+            u64_variable_length_integer_ntt_multiplication(a, a, c, length_a, base);
+        } else {
+            std::vector<uint64_t> scratch(u64_karatsuba_scratch_length(length_a, karatsuba_threshold));
+            u64_variable_length_integer_karatsuba_squaring(a, c, length_a, base, scratch.data(), karatsuba_threshold);
+        }
+        return;
+    }
+    std::vector<uint64_t> block(length_b), product(length_b << 1);
+    std::vector<uint64_t> scratch(ntt ? 0 : u64_karatsuba_scratch_length(length_b, karatsuba_threshold));
+    for (size_t offset = 0; offset < length_a; offset += length_b) {
+        const size_t part = std::min<size_t>(length_b, length_a - offset);
+        std::copy(a + offset, a + offset + part, block.begin());
+        std::fill(block.begin() + part, block.end(), 0ull);
+        if (ntt) {
+            u64_variable_length_integer_ntt_multiplication(block.data(), b, product.data(), length_b, base);
+        } else {
+            u64_variable_length_integer_karatsuba_multiplication(block.data(), b, product.data(), length_b, base, scratch.data(), karatsuba_threshold);
+        }
+        u64_variable_length_integer_addition_in_place(c + offset, product.data(), length - offset, std::min<size_t>(length_b << 1, length - offset), base);
+    }
+    return;
+}
+
+template<typename Radix>
+inline void u64_variable_length_integer_schoolbook_division(u64arr u, const size_t length_u, const u64arr v, const size_t length_v, u64arr q, u64arr scratch, const Radix base) noexcept {
+    /* Knuth's algorithm D: divides u (length_u limbs) by the normalized v (length_v >= 2 limbs, top limb at least base / 2).
+       The leading length_v limbs of u must be less than v, which an extra leading limb of u guarantees.
+       q receives (length_u - length_v) limbs, the remainder is left in u[0, length_v). scratch holds (length_v + 1) limbs. */
+    const unsigned __int128 beta = u64_radix_value(base);
+    const size_t n = length_v;
+    for (size_t j = length_u - n; j-- > 0; ) {
+        const unsigned __int128 numerator = u[j + n] * beta + u[j + n - 1];
+        unsigned __int128 qhat = numerator / v[n - 1], rhat = numerator % v[n - 1];
+        while (qhat >= beta || qhat * v[n - 2] > rhat * beta + u[j + n - 2]) {
+            qhat--;
+            rhat += v[n - 1];
+            if (rhat >= beta) {
+                break;
+            }
+        }
+        std::fill(scratch, scratch + n + 1, 0ull);
+        u64_variable_length_integer_multiply_add_small(scratch, v, n + 1, n, static_cast<uint64_t>(qhat), base);
+        if (u64_variable_length_integer_subtraction_in_place(u + j, scratch, n + 1, n + 1, base)) {
+            //The estimate was one too large (rarely), adding v back cancels the borrow.
+            qhat--;
+            u64_variable_length_integer_addition_in_place(u + j, v, n + 1, n, base);
+        }
+        q[j] = static_cast<uint64_t>(qhat);
+    }
+    return;
+}
+
+template<typename Radix>
+inline uint64_t u64_normalization_factor(const uint64_t top, const Radix base) noexcept {
+    //Single-limb factor bringing the leading limb top of a divisor to at least half of the base.
+    return base / (top + 1);
+}
+
+inline uint64_t u64_normalization_factor(const uint64_t top, NativeRadix) noexcept {
+    return 1ull << std::countl_zero(top);
+}
+
+constexpr size_t u64_modulo_scratch_length(const size_t length_u, const size_t length_v) noexcept {
+    //Scratch limbs required by u64_variable_length_integer_modulo.
+    return ((length_u + length_v) << 1) + 4;
+}
+
+template<typename Radix>
+inline void u64_variable_length_integer_modulo(const u64arr u, size_t length_u, const u64arr v, const size_t length_v, u64arr r, u64arr scratch, const Radix base) noexcept {
+    /* Computes r = u mod v, where the leading limb of v (length_v limbs) is nonzero and r receives length_v limbs.
+       u is left untouched, scratch holds u64_modulo_scratch_length(length_u, length_v) limbs. */
+    std::fill(r, r + length_v, 0ull);
+    length_u = u64_variable_length_integer_significant_length(u, length_u);
+    if (u64_variable_length_integer_compare_unbalanced(u, length_u, v, length_v) < 0) {
+        std::copy(u, u + length_u, r);
+        return;
+    }
+    if (length_v == 1) {
+        std::copy(u, u + length_u, scratch);
+        r[0] = u64_variable_length_integer_division_by_small(scratch, length_u, v[0], base);
+        return;
+    }
+    const uint64_t factor = u64_normalization_factor(v[length_v - 1], base);
+    const size_t length_n = length_u + 1;
+    u64arr dividend = scratch, divisor = dividend + length_n, quotient = divisor + length_v, rest = quotient + (length_n - length_v);
+    std::fill(dividend, dividend + length_n, 0ull);
+    u64_variable_length_integer_multiply_add_small(dividend, u, length_n, length_u, factor, base);
+    std::fill(divisor, divisor + length_v, 0ull);
+    u64_variable_length_integer_multiply_add_small(divisor, v, length_v, length_v, factor, base);
+    u64_variable_length_integer_schoolbook_division(dividend, length_n, divisor, length_v, quotient, rest, base);
+    std::copy(dividend, dividend + length_v, r);
+    u64_variable_length_integer_division_by_small(r, length_v, factor, base);
+    return;
+}
+
+template<typename Radix>
+inline void u64_variable_length_integer_reciprocal(const u64arr d, const size_t n, u64arr v, const Radix base, const size_t threshold, const size_t karatsuba_threshold, const size_t ntt_threshold) {
+    /* Computes v = floor(base ^ 2n / d) for the normalized d (n >= 2 limbs, top limb at least base / 2), v receives (n + 1) limbs.
+       Short divisors take the schoolbook quotient. Otherwise the reciprocal V_h of the leading h limbs is lifted by one
+       Newton step V = V_h * base ^ (n - h) + V_h * (base ^ (n + h) - d * V_h) / base ^ 2h, which is a few units off,
+       and corrected from the exact residual base ^ 2n - d * V. */
+    std::fill(v, v + n + 1, 0ull);
+    if (n <= std::max<size_t>(threshold, 3)) {
+        std::vector<uint64_t> u((n << 1) + 1, 0ull), scratch(n + 1);
+        u[n << 1] = 1ull;
+        u64_variable_length_integer_schoolbook_division(u.data(), (n << 1) + 1, d, n, v, scratch.data(), base);
+        return;
+    }
+    const size_t h = (n >> 1) + 1;
+    uint64_t one = 1ull;
+    std::vector<uint64_t> v_h(h + 1), product(n + h + 1), residual(n + h + 1, 0ull), correction(n + (h << 1) + 2), w(n + 2, 0ull);
+    u64_variable_length_integer_reciprocal(d + (n - h), h, v_h.data(), base, threshold, karatsuba_threshold, ntt_threshold);
+    //The residual base ^ (n + h) - d * V_h may take either sign, its magnitude is kept with the sign apart.
+    u64_variable_length_integer_unbalanced_multiplication(d, v_h.data(), product.data(), n, h + 1, base, karatsuba_threshold, ntt_threshold);
+    residual[n + h] = 1ull;
+    const bool negative = u64_variable_length_integer_subtraction_in_place(residual.data(), product.data(), n + h + 1, n + h + 1, base);
+    if (negative) {
+        u64_variable_length_integer_complement_in_place(residual.data(), n + h + 1, base);
+    }
+    u64_variable_length_integer_unbalanced_multiplication(v_h.data(), residual.data(), correction.data(), h + 1, n + h + 1, base, karatsuba_threshold, ntt_threshold);
+    std::copy(v_h.begin(), v_h.end(), w.begin() + (n - h));
+    if (negative) {
+        u64_variable_length_integer_subtraction_in_place(w.data(), correction.data() + (h << 1), n + 2, n + 2, base);
+    } else {
+        u64_variable_length_integer_addition_in_place(w.data(), correction.data() + (h << 1), n + 2, n + 2, base);
+    }
+    //Exact residual base ^ 2n - d * V, wrapped modulo base ^ (2n + 2) while negative.
+    std::vector<uint64_t> remainder((n << 1) + 2, 0ull), check((n << 1) + 2);
+    u64_variable_length_integer_unbalanced_multiplication(d, w.data(), check.data(), n, n + 2, base, karatsuba_threshold, ntt_threshold);
+    remainder[n << 1] = 1ull;
+    bool below = u64_variable_length_integer_subtraction_in_place(remainder.data(), check.data(), (n << 1) + 2, (n << 1) + 2, base);
+    while (below) {
+        u64_variable_length_integer_subtraction_in_place(w.data(), &one, n + 2, 1, base);
+        below = !u64_variable_length_integer_addition_in_place(remainder.data(), d, (n << 1) + 2, n, base);
+    }
+    while (u64_variable_length_integer_compare_unbalanced(remainder.data(), (n << 1) + 2, d, n) >= 0) {
+        u64_variable_length_integer_addition_in_place(w.data(), &one, n + 2, 1, base);
+        u64_variable_length_integer_subtraction_in_place(remainder.data(), d, (n << 1) + 2, n, base);
+    }
+    std::copy(w.begin(), w.begin() + n + 1, v);
+    return;
+}
+
+template<typename Radix>
+inline void u64_variable_length_integer_reciprocal_division(const u64arr a, const size_t length_a, const u64arr d, const u64arr v, const size_t n, u64arr q, u64arr r, const Radix base, const size_t karatsuba_threshold, const size_t ntt_threshold) {
+    /* Divides a (length_a <= 2n limbs) by the normalized d (n >= 2 limbs) with its reciprocal v = floor(base ^ 2n / d).
+       The estimate floor(a / base ^ (n - 1)) * v / base ^ (n + 1) is at most 2 below the quotient (Barrett),
+       the remainder corrects it. q receives (n + 1) limbs and r receives n limbs. */
+    uint64_t one = 1ull;
+    std::fill(q, q + n + 1, 0ull);
+    std::fill(r, r + n, 0ull);
+    if (length_a < n) {
+        //a < base ^ (n - 1) <= d.
+        std::copy(a, a + length_a, r);
+        return;
+    }
+    const size_t length_t = length_a - (n - 1);
+    std::vector<uint64_t> estimate(length_t + n + 1), product((n << 1) + 1), remainder((n << 1) + 1, 0ull);
+    u64_variable_length_integer_unbalanced_multiplication(a + (n - 1), v, estimate.data(), length_t, n + 1, base, karatsuba_threshold, ntt_threshold);
+    std::copy(estimate.begin() + (n + 1), estimate.end(), q);
+    u64_variable_length_integer_unbalanced_multiplication(q, d, product.data(), n + 1, n, base, karatsuba_threshold, ntt_threshold);
+    std::copy(a, a + length_a, remainder.begin());
+    u64_variable_length_integer_subtraction_in_place(remainder.data(), product.data(), (n << 1) + 1, (n << 1) + 1, base);
+    while (u64_variable_length_integer_compare_unbalanced(remainder.data(), (n << 1) + 1, d, n) >= 0) {
+        u64_variable_length_integer_addition_in_place(q, &one, n + 1, 1, base);
+        u64_variable_length_integer_subtraction_in_place(remainder.data(), d, (n << 1) + 1, n, base);
+    }
+    std::copy(remainder.begin(), remainder.begin() + n, r);
+    return;
+}
+
+inline std::vector<size_t> u64_newton_precision_ladder(size_t precision, const size_t base_precision) {
+    /* Precisions (in limbs) of the Newton reciprocal iteration in ascending order. Every iteration almost doubles
+       the precision, the first one is reached directly by the schoolbook division. */
+    std::vector<size_t> ladder{precision};
+    while (precision > std::max<size_t>(base_precision, 2)) {
+        precision = std::min<size_t>(((precision + 1) >> 1) + 1, precision - 1);
+        ladder.emplace_back(precision);
+    }
+    std::reverse(ladder.begin(), ladder.end());
+    return ladder;
+}
+
+}
@@ -0,0 +1,443 @@
+#pragma once
+
+#include <array>
+#include <vector>
+
+#include "DivisionFunctions.hpp"
+
+namespace mpengine {
+
+/**
+ * @brief Kernels of the greatest common divisor by Lehmer's algorithm and the half-GCD recursion.
+ *
+ * The operands are vectors of limbs without leading zeros. A reduction replaces (a, b) by (a', b') with
+ * (a, b) = M (a', b'), where M is a product of the Euclidean quotient matrices [[q, 1], [1, 0]] (and swaps),
+ * so that M has non-negative entries, its determinant is +/- 1 and gcd(a, b) = gcd(a', b'):
+ * - a Lehmer step runs Euclid on the leading word of a and b as long as the quotients are certainly those
+ *   of a and b (Knuth's algorithm L), then applies the single-word matrix to a and b,
+ * - the half-GCD of n limbs reduces a and b to about n / 2 limbs by two recursive half-GCDs of their leading
+ *   limbs, whose matrices are applied to a and b by the fast multiplication, which costs O(M(n) log n)
+ *   instead of the O(n ^ 2) of the Lehmer steps.
+ * Matrices computed from leading limbs are checked on the full operands: a reduction which would turn
+ * negative is rejected and replaced by an exact division step, so the result never relies on the bounds.
+ */
+
+using u64vec = std::vector<uint64_t>;
+
+struct GcdMatrix {
+    //Entries m00, m01, m10, m11 with (a, b) = M (a', b'), odd when the determinant is -1.
+    std::array<u64vec, 4> entries;
+    bool odd;
+    GcdMatrix(): entries{u64vec{1ull}, u64vec{}, u64vec{}, u64vec{1ull}}, odd(false) {}
+};
+
+inline u64arr u64vec_data(const u64vec& a) noexcept {
+    //The kernels take mutable pointers for their read-only operands as well.
+    return const_cast<u64arr>(a.data());
+}
+
+inline void u64vec_trim(u64vec& a) noexcept {
+    while (!a.empty() && a.back() == 0ull) {
+        a.pop_back();
+    }
+    return;
+}
+
+inline int u64vec_compare(const u64vec& a, const u64vec& b) noexcept {
+    if (a.size() != b.size()) {
+        return a.size() > b.size() ? 1 : -1;
+    }
+    return a.empty() ? 0 : u64_variable_length_integer_compare(u64vec_data(a), u64vec_data(b), a.size());
+}
+
+template<typename Radix>
+inline u64vec u64vec_from_word(uint64_t word, const Radix base) {
+    u64vec result;
+    for (; word != 0ull; word /= base) {
+        result.emplace_back(word % base);
+    }
+    return result;
+}
+
+inline u64vec u64vec_from_word(const uint64_t word, NativeRadix) {
+    return word != 0ull ? u64vec{word} : u64vec{};
+}
+
+template<typename Radix>
+inline u64vec u64vec_multiply(const u64vec& a, const u64vec& b, const Radix base, const size_t karatsuba_threshold, const size_t ntt_threshold) {
+    if (a.empty() || b.empty()) {
+        return u64vec{};
+    }
+    u64vec c(a.size() + b.size(), 0ull);
+    u64_variable_length_integer_unbalanced_multiplication(
+        u64vec_data(a), u64vec_data(b), c.data(), a.size(), b.size(), base, karatsuba_threshold, ntt_threshold
+    );
+    u64vec_trim(c);
+    return c;
+}
+
+template<typename Radix>
+inline u64vec u64vec_multiply_small(const u64vec& a, const uint64_t m, const Radix base) {
+    //m may exceed a compact limb, but stays below the square of the base.
+    u64vec c(a.size() + 2, 0ull);
+    u64_variable_length_integer_multiply_add_small(c.data(), u64vec_data(a), c.size(), a.size(), m, base);
+    u64vec_trim(c);
+    return c;
+}
+
+template<typename Radix>
+inline void u64vec_add(u64vec& c, const u64vec& a, const Radix base) {
+    //c += a.
+    c.resize(std::max<size_t>(c.size(), a.size()) + 1, 0ull);
+    u64_variable_length_integer_addition_in_place(c.data(), u64vec_data(a), c.size(), a.size(), base);
+    u64vec_trim(c);
+    return;
+}
+
+template<typename Radix>
+inline bool u64vec_difference(u64vec& c, const u64vec& x, const u64vec& y, const Radix base) {
+    //c = x - y, returns false (leaving c untouched) if x < y.
+    if (u64vec_compare(x, y) < 0) {
+        return false;
+    }
+    u64vec result(x);
+    u64_variable_length_integer_subtraction_in_place(result.data(), u64vec_data(y), result.size(), y.size(), base);
+    u64vec_trim(result);
+    c = std::move(result);
+    return true;
+}
+
+template<typename Radix>
+inline bool u64vec_combination(u64vec& c, const u64vec& a, const int64_t x, const u64vec& b, const int64_t y, const Radix base) {
+    //c = x a + y b for single-word x and y, returns false (leaving c untouched) if negative.
+    u64vec p = u64vec_multiply_small(a, x < 0 ? -static_cast<uint64_t>(x) : static_cast<uint64_t>(x), base);
+    u64vec r = u64vec_multiply_small(b, y < 0 ? -static_cast<uint64_t>(y) : static_cast<uint64_t>(y), base);
+    if (x >= 0 && y >= 0) {
+        u64vec_add(p, r, base);
+        c = std::move(p);
+        return true;
+    } else if (x < 0 && y < 0) {
+        return false;
+    }
+    return x >= 0 ? u64vec_difference(c, p, r, base) : u64vec_difference(c, r, p, base);
+}
+
+template<typename Radix>
+inline void u64vec_divide(u64vec& a, const u64vec& b, u64vec& q, const Radix base) {
+    //q = a / b and a = a mod b for a non-zero b.
+    q.clear();
+    if (u64vec_compare(a, b) < 0) {
+        return;
+    }
+    const size_t length_a = a.size(), length_b = b.size();
+    if (length_b == 1) {
+        q = a;
+        const uint64_t remainder = u64_variable_length_integer_division_by_small(q.data(), length_a, b[0], base);
+        u64vec_trim(q);
+        a = remainder != 0ull ? u64vec{remainder} : u64vec{};
+        return;
+    }
+    const uint64_t factor = u64_normalization_factor(b.back(), base);
+    u64vec dividend(length_a + 1, 0ull), divisor(length_b, 0ull), scratch(length_b + 1, 0ull);
+    u64_variable_length_integer_multiply_add_small(dividend.data(), a.data(), length_a + 1, length_a, factor, base);
+    u64_variable_length_integer_multiply_add_small(divisor.data(), u64vec_data(b), length_b, length_b, factor, base);
+    q.assign(length_a + 1 - length_b, 0ull);
+    u64_variable_length_integer_schoolbook_division(dividend.data(), length_a + 1, divisor.data(), length_b, q.data(), scratch.data(), base);
+    dividend.resize(length_b);
+    u64_variable_length_integer_division_by_small(dividend.data(), length_b, factor, base);
+    u64vec_trim(dividend);
+    u64vec_trim(q);
+    a = std::move(dividend);
+    return;
+}
+
+template<typename Radix>
+inline void u64_gcd_matrix_multiply(GcdMatrix& M, const GcdMatrix& R, const Radix base, const size_t karatsuba_threshold, const size_t ntt_threshold) {
+    //M = M R.
+    const auto& m = M.entries;
+    const auto& r = R.entries;
+    auto dot = [&](const u64vec& x0, const u64vec& y0, const u64vec& x1, const u64vec& y1) {
+        u64vec result = u64vec_multiply(x0, y0, base, karatsuba_threshold, ntt_threshold);
+        u64vec_add(result, u64vec_multiply(x1, y1, base, karatsuba_threshold, ntt_threshold), base);
+        return result;
+    };
+    GcdMatrix product;
+    product.entries = {dot(m[0], r[0], m[1], r[2]), dot(m[0], r[1], m[1], r[3]), dot(m[2], r[0], m[3], r[2]), dot(m[2], r[1], m[3], r[3])};
+    product.odd = M.odd != R.odd;
+    M = std::move(product);
+    return;
+}
+
+inline void u64_gcd_matrix_swap(GcdMatrix& M) noexcept {
+    //M = M [[0, 1], [1, 0]] for swapping a' and b'.
+    std::swap(M.entries[0], M.entries[1]);
+    std::swap(M.entries[2], M.entries[3]);
+    M.odd = !M.odd;
+    return;
+}
+
+template<typename Radix>
+inline void u64_gcd_matrix_quotient(GcdMatrix& M, const u64vec& q, const Radix base, const size_t karatsuba_threshold, const size_t ntt_threshold) {
+    //M = M [[q, 1], [1, 0]] for the division step (a, b) -> (b, a - q b).
+    for (size_t row = 0; row < 4; row += 2) {
+        u64vec entry = u64vec_multiply(M.entries[row], q, base, karatsuba_threshold, ntt_threshold);
+        u64vec_add(entry, M.entries[row + 1], base);
+        M.entries[row + 1] = std::move(M.entries[row]);
+        M.entries[row] = std::move(entry);
+    }
+    M.odd = !M.odd;
+    return;
+}
+
+template<typename Radix>
+inline bool u64_gcd_matrix_apply(const GcdMatrix& M, u64vec& a, u64vec& b, const Radix base, const size_t karatsuba_threshold, const size_t ntt_threshold) {
+    /* (a, b) = M ^ -1 (a, b), that is (m11 a - m01 b, m00 b - m10 a) up to the sign of the determinant.
+       Returns false (leaving a and b untouched) if either would be negative. */
+    const auto& m = M.entries;
+    const u64vec x = u64vec_multiply(m[3], a, base, karatsuba_threshold, ntt_threshold);
+    const u64vec y = u64vec_multiply(m[1], b, base, karatsuba_threshold, ntt_threshold);
+    const u64vec z = u64vec_multiply(m[0], b, base, karatsuba_threshold, ntt_threshold);
+    const u64vec w = u64vec_multiply(m[2], a, base, karatsuba_threshold, ntt_threshold);
+    u64vec c, d;
+    if (M.odd ? !(u64vec_difference(c, y, x, base) && u64vec_difference(d, w, z, base))
+              : !(u64vec_difference(c, x, y, base) && u64vec_difference(d, z, w, base))) {
+        return false;
+    }
+    a = std::move(c);
+    b = std::move(d);
+    return true;
+}
+
+template<typename Radix>
+inline void u64_gcd_leading_words(const u64vec& a, const u64vec& b, uint64_t& u, uint64_t& v, const Radix base) noexcept {
+    //u = floor(a / S) and v = floor(b / S) for S = base ^ (n - 2), the two leading limbs of a (n limbs) fit in a word.
+    const size_t n = a.size();
+    auto limb = [](const u64vec& x, size_t i) {
+        return i < x.size() ? x[i] : 0ull;
+    };
+    u = n == 1 ? a[0] : a[n - 1] * base + a[n - 2];
+    v = n == 1 ? limb(b, 0) : limb(b, n - 1) * base + limb(b, n - 2);
+    return;
+}
+
+inline void u64_gcd_leading_words(const u64vec& a, const u64vec& b, uint64_t& u, uint64_t& v, NativeRadix) noexcept {
+    //u = floor(a / S) and v = floor(b / S) for a power of two S, u taking the leading 64 bits of a.
+    const size_t n = a.size();
+    auto limb = [](const u64vec& x, size_t i) {
+        return i < x.size() ? x[i] : 0ull;
+    };
+    if (n == 1) {
+        u = a[0];
+        v = limb(b, 0);
+        return;
+    }
+    const int shift = std::countl_zero(a[n - 1]);
+    auto leading = [&](const u64vec& x) {
+        return shift == 0 ? limb(x, n - 1) : (limb(x, n - 1) << shift) | (limb(x, n - 2) >> (64 - shift));
+    };
+    u = leading(a);
+    v = leading(b);
+    return;
+}
+
+template<uint64_t Base>
+inline void u64_gcd_leading_words(const u64vec& a, const u64vec& b, uint64_t& u, uint64_t& v, WideRadix<Base>) noexcept {
+    //The two leading limbs exceed a word, u takes their leading 64 bits (S = base ^ (n - 2) * 2 ^ shift).
+    const size_t n = a.size();
+    auto limb = [](const u64vec& x, size_t i) {
+        return i < x.size() ? x[i] : 0ull;
+    };
+    if (n == 1) {
+        u = a[0];
+        v = limb(b, 0);
+        return;
+    }
+    const unsigned __int128 leading_a = static_cast<unsigned __int128>(a[n - 1]) * Base + a[n - 2];
+    const unsigned __int128 leading_b = static_cast<unsigned __int128>(limb(b, n - 1)) * Base + limb(b, n - 2);
+    const uint64_t top = static_cast<uint64_t>(leading_a >> 64);
+    const int shift = top == 0ull ? 0 : 64 - std::countl_zero(top);
+    u = static_cast<uint64_t>(leading_a >> shift);
+    v = static_cast<uint64_t>(leading_b >> shift);
+    return;
+}
+
+constexpr int64_t u64_gcd_cofactor_limit(const uint64_t) noexcept {
+    //Lehmer cofactors times a compact limb fit in a word.
+    return int64_t(1) << 31;
+}
+
+constexpr int64_t u64_gcd_cofactor_limit(NativeRadix) noexcept {
+    return int64_t(1) << 62;
+}
+
+template<uint64_t Base>
+constexpr int64_t u64_gcd_cofactor_limit(WideRadix<Base>) noexcept {
+    //Lehmer cofactors times a wide limb are 128-bit, as for the native radix.
+    return int64_t(1) << 62;
+}
+
+template<typename Radix>
+inline size_t u64_gcd_lehmer_quotients(const u64vec& a, const u64vec& b, int64_t (&cofactors)[4], const Radix base) noexcept {
+    /* Knuth's algorithm L on the leading words u >= v of a >= b: Euclid runs on (u, v) as long as the quotients
+       (u + A) / (v + C) and (u + B) / (v + D) agree, which makes them the quotients of (a, b) as well.
+       The reduction is (a', b') = (A a + B b, C a + D b), returns the number of quotients. */
+    uint64_t u_word = 0ull, v_word = 0ull;
+    u64_gcd_leading_words(a, b, u_word, v_word, base);
+    const __int128 limit = u64_gcd_cofactor_limit(base);
+    __int128 u = u_word, v = v_word, A = 1, B = 0, C = 0, D = 1;
+    size_t steps = 0;
+    while (v + C > 0 && v + D > 0) {
+        const __int128 q = (u + A) / (v + C);
+        if (q != (u + B) / (v + D)) {
+            break;
+        }
+        const __int128 next_C = A - q * C, next_D = B - q * D;
+        if (next_C > limit || next_C < -limit || next_D > limit || next_D < -limit) {
+            break;
+        }
+        A = C;
+        C = next_C;
+        B = D;
+        D = next_D;
+        const __int128 r = u - q * v;
+        u = v;
+        v = r;
+        steps++;
+    }
+    cofactors[0] = static_cast<int64_t>(A);
+    cofactors[1] = static_cast<int64_t>(B);
+    cofactors[2] = static_cast<int64_t>(C);
+    cofactors[3] = static_cast<int64_t>(D);
+    return steps;
+}
+
+template<typename Radix>
+inline bool u64_gcd_step(u64vec& a, u64vec& b, const size_t s, GcdMatrix* M, const Radix base, const size_t karatsuba_threshold, const size_t ntt_threshold) {
+    /* One Lehmer step, or one division step where Lehmer's quotients fall short, as long as both a and b keep
+       more than s limbs. M (if any) accumulates the reduction. Returns false if there is no such step,
+       in which case a and b are only ordered (a >= b). */
+    if (u64vec_compare(a, b) < 0) {
+        std::swap(a, b);
+        if (M != nullptr) {
+            u64_gcd_matrix_swap(*M);
+        }
+    }
+    if (b.size() <= s) {
+        return false;
+    }
+    int64_t cofactors[4];
+    const size_t steps = u64_gcd_lehmer_quotients(a, b, cofactors, base);
+    if (steps > 0) {
+        u64vec c, d;
+        if (u64vec_combination(c, a, cofactors[0], b, cofactors[1], base) && u64vec_combination(d, a, cofactors[2], b, cofactors[3], base) &&
+            c.size() > s && d.size() > s) {
+            a = std::move(c);
+            b = std::move(d);
+            if (M != nullptr) {
+                //The inverse of [[A, B], [C, D]] is [[|D|, |B|], [|C|, |A|]] up to the sign of the determinant.
+                auto magnitude = [&](int64_t x) {
+                    return u64vec_from_word(x < 0 ? -static_cast<uint64_t>(x) : static_cast<uint64_t>(x), base);
+                };
+                GcdMatrix R;
+                R.entries = {magnitude(cofactors[3]), magnitude(cofactors[1]), magnitude(cofactors[2]), magnitude(cofactors[0])};
+                R.odd = (steps & 1) != 0;
+                u64_gcd_matrix_multiply(*M, R, base, karatsuba_threshold, ntt_threshold);
+            }
+            return true;
+        }
+    }
+    u64vec r = a, q;
+    u64vec_divide(r, b, q, base);
+    if (r.size() <= s) {
+        return false;
+    }
+    a = std::move(b);
+    b = std::move(r);
+    if (M != nullptr) {
+        u64_gcd_matrix_quotient(*M, q, base, karatsuba_threshold, ntt_threshold);
+    }
+    return true;
+}
+
+template<typename Radix>
+inline bool u64_half_gcd(u64vec& a, u64vec& b, GcdMatrix& M, const Radix base, const size_t hgcd_threshold, const size_t karatsuba_threshold, const size_t ntt_threshold) {
+    /* Reduces (a, b) of n limbs as long as both keep more than s = n / 2 + 1 limbs, with (a, b) = M (a', b') on return.
+       Returns whether any reduction happened. */
+    M = GcdMatrix();
+    const size_t n = std::max<size_t>(a.size(), b.size()), s = n / 2 + 1;
+    if (std::min<size_t>(a.size(), b.size()) <= s) {
+        return false;
+    }
+    bool reduced = false;
+    if (n >= hgcd_threshold) {
+        auto reduce_leading = [&](const size_t p) {
+            //The reduction of the limbs above p applies to the full operands.
+            if (std::min<size_t>(a.size(), b.size()) <= p) {
+                return;
+            }
+            u64vec a_high(a.begin() + p, a.end()), b_high(b.begin() + p, b.end());
+            GcdMatrix R;
+            if (u64_half_gcd(a_high, b_high, R, base, hgcd_threshold, karatsuba_threshold, ntt_threshold) &&
+                u64_gcd_matrix_apply(R, a, b, base, karatsuba_threshold, ntt_threshold)) {
+                u64_gcd_matrix_multiply(M, R, base, karatsuba_threshold, ntt_threshold);
+                reduced = true;
+            }
+        };
+        //The leading n / 2 limbs reduce to about n / 4 limbs, which leaves about 3n / 4 limbs of a and b.
+        reduce_leading(n / 2);
+        while (std::max<size_t>(a.size(), b.size()) > (3 * n) / 4 + 1) {
+            if (!u64_gcd_step(a, b, s, &M, base, karatsuba_threshold, ntt_threshold)) {
+                return reduced;
+            }
+            reduced = true;
+        }
+        const size_t m = std::max<size_t>(a.size(), b.size());
+        if (m > s + 2) {
+            reduce_leading(2 * s - m + 1);
+        }
+    }
+    while (u64_gcd_step(a, b, s, &M, base, karatsuba_threshold, ntt_threshold)) {
+        reduced = true;
+    }
+    return reduced;
+}
+
+template<typename Radix>
+inline void u64_variable_length_integer_gcd(u64vec& a, u64vec& b, GcdMatrix* M, const Radix base, const size_t hgcd_threshold, const size_t karatsuba_threshold, const size_t ntt_threshold) {
+    //Reduces (a, b) to (gcd(a, b), 0), where (a, b) = M (g, 0) on return if M is given.
+    while (!b.empty()) {
+        if (u64vec_compare(a, b) < 0) {
+            std::swap(a, b);
+            if (M != nullptr) {
+                u64_gcd_matrix_swap(*M);
+            }
+            continue;
+        }
+        const size_t n = a.size(), p = n / 2;
+        if (n >= hgcd_threshold && b.size() > p) {
+            u64vec a_high(a.begin() + p, a.end()), b_high(b.begin() + p, b.end());
+            GcdMatrix R;
+            if (u64_half_gcd(a_high, b_high, R, base, hgcd_threshold, karatsuba_threshold, ntt_threshold) &&
+                u64_gcd_matrix_apply(R, a, b, base, karatsuba_threshold, ntt_threshold)) {
+                if (M != nullptr) {
+                    u64_gcd_matrix_multiply(*M, R, base, karatsuba_threshold, ntt_threshold);
+                }
+                continue;
+            }
+        }
+        if (u64_gcd_step(a, b, 0, M, base, karatsuba_threshold, ntt_threshold)) {
+            continue;
+        }
+        //Only the last division step, whose remainder vanishes, is left.
+        u64vec r = a, q;
+        u64vec_divide(r, b, q, base);
+        a = std::move(b);
+        b = std::move(r);
+        if (M != nullptr) {
+            u64_gcd_matrix_quotient(*M, q, base, karatsuba_threshold, ntt_threshold);
+        }
+    }
+    return;
+}
+
+}
@@ -4,4 +4,6 @@ namespace mpengine {
 
 enum class IOBasic { oct, dec, hex };
 
+enum class StoreRadix { compact, native, wide };
+
 }
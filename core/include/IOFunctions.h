@@ -34,6 +34,52 @@ constexpr uint64_t log_store_base(IOBasic iobasic) noexcept {
     }
 }
 
+constexpr uint64_t store_base(IOBasic iobasic, StoreRadix radix) noexcept {
+    /* Wide limbs hold 2 ^ 60 values (20 octal digits, 15 hex digits) or 10 ^ 18 values, the squares of a 30-bit base,
+       and far enough below 2 ^ 64 that the sum of two limbs never overflows. Native limbs have no store base below 2 ^ 64. */
+    switch(radix) {
+        case StoreRadix::compact: return store_base(iobasic);
+        case StoreRadix::native: return 0ull;
+        default: break;
+    }
+    switch(iobasic) {
+        case IOBasic::oct: return 1152921504606846976ull;
+        case IOBasic::dec: return 1000000000000000000ull;
+        case IOBasic::hex: return 1152921504606846976ull;
+        default: return 1000000000000000000ull;
+    }
+}
+
+constexpr uint64_t log_store_base(IOBasic iobasic, StoreRadix radix) noexcept {
+    //Native limbs hold 2 ^ 64 values: 16 hex digits, 19 decimal digits, 21 octal digits (63 bits) are stored per limb.
+    if (radix == StoreRadix::compact) {
+        return log_store_base(iobasic);
+    }
+    if (radix == StoreRadix::wide) {
+        switch(iobasic) {
+            case IOBasic::oct: return 20ull;
+            case IOBasic::dec: return 18ull;
+            case IOBasic::hex: return 15ull;
+            default: return 18ull;
+        }
+    }
+    switch(iobasic) {
+        case IOBasic::oct: return 21ull;
+        case IOBasic::dec: return 19ull;
+        case IOBasic::hex: return 16ull;
+        default: return 19ull;
+    }
+}
+
+constexpr const char* radix_name(StoreRadix radix) noexcept {
+    switch(radix) {
+        case StoreRadix::compact: return "Compact";
+        case StoreRadix::native: return "Native";
+        case StoreRadix::wide: return "Wide";
+        default: return "Compact";
+    }
+}
+
 constexpr const char* base_name(IOBasic iobasic) noexcept {
     switch(iobasic) {
         case IOBasic::oct: return "Oct";
@@ -45,8 +91,8 @@ constexpr const char* base_name(IOBasic iobasic) noexcept {
 
 uint64_t digit_parse(const char digit);
 
-size_t precision_to_log_len(const size_t digits_cnt, const IOBasic iobasic) noexcept;
+size_t precision_to_log_len(const size_t digits_cnt, const IOBasic iobasic, const StoreRadix radix = StoreRadix::compact) noexcept;
 
-void write_store_digit_to_stream(std::ostream& stream, const IOBasic iobasic, uint64_t digit, bool filling) noexcept;
+void write_store_digit_to_stream(std::ostream& stream, const IOBasic iobasic, uint64_t digit, bool filling, const StoreRadix radix = StoreRadix::compact) noexcept;
 
 }
@@ -0,0 +1,245 @@
+#pragma once
+
+#include <bit>
+#include <vector>
+
+#include "DivisionFunctions.hpp"
+
+namespace mpengine {
+
+/**
+ * @brief Kernels of the modular exponentiation by Montgomery multiplication.
+ *
+ * For an odd modulus m of n limbs and R = base ^ n, a residue x is represented by x * R mod m, and the
+ * product of two representations is reduced by REDC(t) = t / R mod m without any division:
+ *
+ *     u = t_0 * (-m_0 ^ -1) mod base,    t = (t + u * m) / base,    repeated n times
+ *
+ * interleaved with the limbs of the multiplier (CIOS). -m_0 ^ -1 exists only for a power-of-two base, so
+ * the kernels serve the native radix and the compact and wide hex and oct radices, where the limb carries are
+ * shifts and masks instead of the divisions by the decimal store base.
+ */
+
+constexpr bool u64_is_binary_radix(const uint64_t base) noexcept {
+    return std::has_single_bit(base);
+}
+
+constexpr bool u64_is_binary_radix(NativeRadix) noexcept {
+    return true;
+}
+
+template<typename Radix>
+inline uint64_t u64_montgomery_inverse(const uint64_t m0, const Radix base) noexcept {
+    //-m0 ^ -1 mod base for an odd m0 and a power-of-two base, by Newton's iteration which doubles the correct bits.
+    uint64_t inverse = m0;
+    for (int i = 0; i < 5; i++) {
+        inverse *= 2ull - m0 * inverse;
+    }
+    return (0ull - inverse) & (base - 1);
+}
+
+inline uint64_t u64_montgomery_inverse(const uint64_t m0, NativeRadix) noexcept {
+    return u64_montgomery_inverse(m0, 0ull);
+}
+
+template<typename Radix>
+inline void u64_montgomery_final_subtraction(u64arr t, const u64arr m, u64arr c, const size_t length, const Radix base) noexcept {
+    //t (length + 1 limbs) is less than 2m, c = t - m if t >= m (a borrow out of length limbs cancels t[length]), otherwise c = t.
+    if (t[length] != 0ull || u64_variable_length_integer_compare(t, m, length) >= 0) {
+        u64_variable_length_integer_subtraction_with_carry_a_ge_b(t, m, c, length, base);
+    } else {
+        std::copy(t, t + length, c);
+    }
+    return;
+}
+
+template<typename Radix>
+inline void u64_montgomery_multiplication(const u64arr a, const u64arr b, u64arr c, const u64arr m, const size_t length, const uint64_t inverse, u64arr scratch, const Radix base) noexcept {
+    /* Computes c = a * b / base ^ length mod m for a, b < m (length limbs each) and a power-of-two base.
+       scratch holds (length + 2) limbs, c may alias a or b. */
+    const int shift = std::countr_zero<uint64_t>(base);
+    const uint64_t mask = base - 1;
+    u64arr t = scratch;
+    std::fill(t, t + length + 2, 0ull);
+    for (size_t i = 0; i < length; i++) {
+        uint64_t carry = 0ull;
+        for (size_t j = 0; j < length; j++) {
+            const uint64_t total = a[i] * b[j] + t[j] + carry;
+            t[j] = total & mask;
+            carry = total >> shift;
+        }
+        t[length] += carry;
+        t[length + 1] = t[length] >> shift;
+        t[length] &= mask;
+        const uint64_t u = (t[0] * inverse) & mask;
+        carry = (u * m[0] + t[0]) >> shift;
+        for (size_t j = 1; j < length; j++) {
+            const uint64_t total = u * m[j] + t[j] + carry;
+            t[j - 1] = total & mask;
+            carry = total >> shift;
+        }
+        const uint64_t total = t[length] + carry;
+        t[length - 1] = total & mask;
+        t[length] = t[length + 1] + (total >> shift);
+        t[length + 1] = 0ull;
+    }
+    u64_montgomery_final_subtraction(t, m, c, length, base);
+    return;
+}
+
+inline void u64_montgomery_multiplication(const u64arr a, const u64arr b, u64arr c, const u64arr m, const size_t length, const uint64_t inverse, u64arr scratch, NativeRadix) noexcept {
+    u64arr t = scratch;
+    std::fill(t, t + length + 2, 0ull);
+    for (size_t i = 0; i < length; i++) {
+        uint64_t carry = 0ull;
+        for (size_t j = 0; j < length; j++) {
+            const unsigned __int128 total = static_cast<unsigned __int128>(a[i]) * b[j] + t[j] + carry;
+            t[j] = static_cast<uint64_t>(total);
+            carry = static_cast<uint64_t>(total >> 64);
+        }
+        t[length + 1] = u64_native_add_with_carry(0, t[length], carry, t[length]);
+        const uint64_t u = t[0] * inverse;
+        carry = static_cast<uint64_t>((static_cast<unsigned __int128>(u) * m[0] + t[0]) >> 64);
+        for (size_t j = 1; j < length; j++) {
+            const unsigned __int128 total = static_cast<unsigned __int128>(u) * m[j] + t[j] + carry;
+            t[j - 1] = static_cast<uint64_t>(total);
+            carry = static_cast<uint64_t>(total >> 64);
+        }
+        const unsigned char overflow = u64_native_add_with_carry(0, t[length], carry, t[length - 1]);
+        t[length] = t[length + 1] + overflow;
+        t[length + 1] = 0ull;
+    }
+    u64_montgomery_final_subtraction(t, m, c, length, NativeRadix{});
+    return;
+}
+
+template<uint64_t Base>
+inline void u64_montgomery_multiplication(const u64arr a, const u64arr b, u64arr c, const u64arr m, const size_t length, const uint64_t inverse, u64arr scratch, WideRadix<Base>) noexcept {
+    //Called for the 2 ^ 60 base only: the limb products are 128-bit, the carries shifted out of them stay below 2 ^ 61.
+    constexpr int shift = std::countr_zero(Base);
+    constexpr uint64_t mask = Base - 1;
+    u64arr t = scratch;
+    std::fill(t, t + length + 2, 0ull);
+    for (size_t i = 0; i < length; i++) {
+        uint64_t carry = 0ull;
+        for (size_t j = 0; j < length; j++) {
+            const unsigned __int128 total = static_cast<unsigned __int128>(a[i]) * b[j] + t[j] + carry;
+            t[j] = static_cast<uint64_t>(total) & mask;
+            carry = static_cast<uint64_t>(total >> shift);
+        }
+        t[length] += carry;
+        t[length + 1] = t[length] >> shift;
+        t[length] &= mask;
+        const uint64_t u = (t[0] * inverse) & mask;
+        carry = static_cast<uint64_t>((static_cast<unsigned __int128>(u) * m[0] + t[0]) >> shift);
+        for (size_t j = 1; j < length; j++) {
+            const unsigned __int128 total = static_cast<unsigned __int128>(u) * m[j] + t[j] + carry;
+            t[j - 1] = static_cast<uint64_t>(total) & mask;
+            carry = static_cast<uint64_t>(total >> shift);
+        }
+        const uint64_t total = t[length] + carry;
+        t[length - 1] = total & mask;
+        t[length] = t[length + 1] + (total >> shift);
+        t[length + 1] = 0ull;
+    }
+    u64_montgomery_final_subtraction(t, m, c, length, WideRadix<Base>{});
+    return;
+}
+
+template<typename Radix>
+inline std::vector<uint64_t> u64_variable_length_integer_binary_words(const u64arr a, size_t length, const Radix base) {
+    //The magnitude of a as 64-bit words (least significant first, no leading zero words), the exponent of a power.
+    std::vector<uint64_t> words;
+    length = u64_variable_length_integer_significant_length(a, length);
+    if (u64_is_binary_radix(base)) {
+        const int shift = std::countr_zero<uint64_t>(base);
+        unsigned __int128 buffer = 0;
+        int bits = 0;
+        for (size_t i = 0; i < length; i++) {
+            buffer |= static_cast<unsigned __int128>(a[i]) << bits;
+            bits += shift;
+            if (bits >= 64) {
+                words.emplace_back(static_cast<uint64_t>(buffer));
+                buffer >>= 64;
+                bits -= 64;
+            }
+        }
+        words.emplace_back(static_cast<uint64_t>(buffer));
+    } else {
+        //Repeated division by 2 ^ 32, which is quadratic but negligible beside the exponentiation itself.
+        std::vector<uint64_t> rest(a, a + length);
+        while (length > 0) {
+            const uint64_t low = u64_variable_length_integer_division_by_small(rest.data(), length, 1ull << 32, base);
+            length = u64_variable_length_integer_significant_length(rest.data(), length);
+            const uint64_t high = length > 0 ? u64_variable_length_integer_division_by_small(rest.data(), length, 1ull << 32, base) : 0ull;
+            length = u64_variable_length_integer_significant_length(rest.data(), length);
+            words.emplace_back(low | (high << 32));
+        }
+    }
+    while (!words.empty() && words.back() == 0ull) {
+        words.pop_back();
+    }
+    return words;
+}
+
+inline std::vector<uint64_t> u64_variable_length_integer_binary_words(const u64arr a, size_t length, NativeRadix) {
+    length = u64_variable_length_integer_significant_length(a, length);
+    return std::vector<uint64_t>(a, a + length);
+}
+
+inline size_t u64_sliding_window_size(const size_t bits) noexcept {
+    //Window width minimizing the table precomputation plus the window multiplications for an exponent of the given bits.
+    constexpr size_t thresholds[] = {7, 25, 81, 241, 673};
+    size_t window = 1;
+    for (const size_t threshold: thresholds) {
+        window += bits > threshold;
+    }
+    return window;
+}
+
+constexpr size_t u64_sliding_window_table_slots(const size_t window) noexcept {
+    //The odd powers g, g ^ 3, ..., g ^ (2 ^ window - 1) and g ^ 2.
+    return (size_t(1) << (window - 1)) + 1;
+}
+
+template<typename Multiply>
+inline void u64_sliding_window_exponentiation(u64arr x, const u64arr g, const std::vector<uint64_t>& exponent, const size_t length, u64arr table, Multiply&& multiply) {
+    /* Computes x = x * g ^ exponent, where multiply(c, a, b) computes c = a * b in the representation of the residues
+       (c may alias a or b), all of length limbs. table holds u64_sliding_window_table_slots(window) residues. */
+    if (exponent.empty()) {
+        return;
+    }
+    const size_t bits = (exponent.size() << 6) - std::countl_zero(exponent.back());
+    const size_t window = u64_sliding_window_size(bits), slots = size_t(1) << (window - 1);
+    u64arr square = table + slots * length;
+    std::copy(g, g + length, table);
+    multiply(square, g, g);
+    for (size_t k = 1; k < slots; k++) {
+        multiply(table + k * length, table + (k - 1) * length, square);
+    }
+    auto bit = [&](size_t i) {
+        return (exponent[i >> 6] >> (i & 63)) & 1ull;
+    };
+    for (size_t i = bits; i > 0; ) {
+        if (bit(i - 1) == 0ull) {
+            multiply(x, x, x);
+            i--;
+            continue;
+        }
+        //The longest window [j, i) of at most window bits ending with a set bit.
+        size_t j = i > window ? i - window : 0;
+        while (bit(j) == 0ull) {
+            j++;
+        }
+        uint64_t value = 0ull;
+        for (size_t k = i; k-- > j; ) {
+            value = (value << 1) | bit(k);
+            multiply(x, x, x);
+        }
+        multiply(x, x, table + (value >> 1) * length);
+        i = j;
+    }
+    return;
+}
+
+}
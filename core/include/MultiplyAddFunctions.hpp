@@ -0,0 +1,65 @@
+#pragma once
+
+#include "DivisionFunctions.hpp"
+
+namespace mpengine {
+
+/**
+ * @brief Kernels of the fused multiply-add c += a * b.
+ *
+ * The product is accumulated into c row by row (schoolbook) or block by block (Karatsuba / NTT block products,
+ * as in the unbalanced multiplication), so the 2n-limb product is never materialized as an integer of its own
+ * and c is traversed once. Limbs of the product above length_c are dropped and reported as truncated.
+ */
+
+template<typename Radix>
+inline uint64_t u64_variable_length_integer_multiply_accumulate(const u64arr a, const u64arr b, u64arr c, const size_t length_a, const size_t length_b, const size_t length_c, const Radix base, const size_t karatsuba_threshold, const size_t ntt_threshold, bool& truncated) {
+    /* Computes c += a * b modulo base ^ length_c, where a and b hold no leading zero limbs.
+       Returns the multiple of base ^ length_c carried out of c. */
+    if (length_a < length_b) {
+        return u64_variable_length_integer_multiply_accumulate(b, a, c, length_b, length_a, length_c, base, karatsuba_threshold, ntt_threshold, truncated);
+    }
+    uint64_t wraps = 0ull;
+    if (length_b == 0) {
+        return wraps;
+    }
+    if (length_b <= std::max<size_t>(karatsuba_threshold, 1)) {
+        for (size_t i = 0; i < length_a; i++) {
+            if (a[i] == 0ull) {
+                continue;
+            }
+            if (i + length_b > length_c) {
+                //b[length_b - 1] is not zero, so the dropped limbs carry a part of the product.
+                truncated = true;
+                if (i >= length_c) {
+                    break;
+                }
+            }
+            wraps += u64_variable_length_integer_multiply_add_small(c + i, b, length_c - i, std::min<size_t>(length_b, length_c - i), a[i], base);
+        }
+        return wraps;
+    }
+    constexpr size_t pieces = u64_ntt_pieces_v<Radix>;
+    const bool ntt = length_b >= ntt_threshold && std::bit_ceil((length_b << 1) * pieces) <= (1ull << ntt_max_log_length);
+    std::vector<uint64_t> block(length_b), product(length_b << 1);
+    std::vector<uint64_t> scratch(ntt ? 0 : u64_karatsuba_scratch_length(length_b, karatsuba_threshold));
+    for (size_t offset = 0; offset < length_a; offset += length_b) {
+        if (offset >= length_c) {
+            truncated = true;
+            break;
+        }
+        const size_t part = std::min<size_t>(length_b, length_a - offset), width = std::min<size_t>(length_b << 1, length_c - offset);
+        std::copy(a + offset, a + offset + part, block.begin());
+        std::fill(block.begin() + part, block.end(), 0ull);
+        if (ntt) {
+            u64_variable_length_integer_ntt_multiplication(block.data(), b, product.data(), length_b, base);
+        } else {
+            u64_variable_length_integer_karatsuba_multiplication(block.data(), b, product.data(), length_b, base, scratch.data(), karatsuba_threshold);
+        }
+        truncated |= std::any_of(product.begin() + width, product.end(), [](uint64_t limb) { return limb != 0ull; });
+        wraps += u64_variable_length_integer_addition_in_place(c + offset, product.data(), length_c - offset, width, base);
+    }
+    return wraps;
+}
+
+}
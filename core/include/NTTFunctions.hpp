@@ -0,0 +1,276 @@
+#pragma once
+
+#include <bit>
+#include <vector>
+#include <cstdint>
+#include <cstdlib>
+#include <utility>
+#include <algorithm>
+#include <type_traits>
+
+#include "ArithmeticFunctions.hpp"
+
+namespace mpengine {
+
+using u32arr = uint32_t*;
+
+struct NTTPrime {
+    uint32_t modulus;
+    uint32_t primitive_root;
+};
+
+/* Three NTT-friendly primes (c * 2 ^ k + 1, k >= 23) whose product (about 2 ^ 86) bounds every convolution coefficient
+   of two 2 ^ 20 limb operands below 2 ^ 28, so the exact coefficients can be recovered by CRT.
+   Native limbs are transformed as 32-bit pieces, the coefficients of 2 ^ 22 pieces stay below 2 ^ 86 as well,
+   and wide limbs as two pieces of their 30-bit piece base. */
+inline constexpr const size_t ntt_prime_count = 3;
+inline constexpr const size_t ntt_max_log_length = 23;
+inline constexpr const NTTPrime ntt_primes[ntt_prime_count] = {
+    {998244353u, 3u},
+    {167772161u, 3u},
+    {469762049u, 3u}
+};
+
+constexpr uint32_t u32_modular_power(uint32_t a, uint64_t e, const uint32_t modulus) noexcept {
+    uint64_t result = 1ull, x = a % modulus;
+    while (e != 0ull) {
+        if (e & 1ull) {
+            result = result * x % modulus;
+        }
+        x = x * x % modulus;
+        e >>= 1;
+    }
+    return static_cast<uint32_t>(result);
+}
+
+template<uint32_t Modulus, uint32_t PrimitiveRoot>
+inline void u32_number_theoretic_transform(u32arr a, const size_t length, const bool inverse) {
+    //In-place iterative Cooley-Tukey transform, length must be a power of two not exceeding 2 ^ ntt_max_log_length.
+    for (size_t i = 1, j = 0; i < length; i++) {
+        size_t bit = length >> 1;
+        for (; j & bit; bit >>= 1) {
+            j ^= bit;
+        }
+        j ^= bit;
+        if (i < j) {
+            std::swap(a[i], a[j]);
+        }
+    }
+    if (length < 2) {
+        return;
+    }
+    //Powers of the primitive length-th root, the transform of each level reads them with a stride.
+    std::vector<uint32_t> twiddles(length >> 1);
+    uint64_t root = u32_modular_power(PrimitiveRoot, (Modulus - 1) / length, Modulus);
+    if (inverse) {
+        root = u32_modular_power(static_cast<uint32_t>(root), Modulus - 2, Modulus);
+    }
+    twiddles[0] = 1u;
+    for (size_t i = 1; i < (length >> 1); i++) {
+        twiddles[i] = static_cast<uint32_t>(twiddles[i - 1] * root % Modulus);
+    }
+    for (size_t step = 1; step < length; step <<= 1) {
+        const size_t stride = length / (step << 1);
+        for (size_t i = 0; i < length; i += step << 1) {
+            for (size_t j = 0; j < step; j++) {
+                const uint32_t u = a[i + j];
+                const uint32_t v = static_cast<uint32_t>(static_cast<uint64_t>(a[i + j + step]) * twiddles[j * stride] % Modulus);
+                a[i + j] = u + v >= Modulus ? u + v - Modulus : u + v;
+                a[i + j + step] = u >= v ? u - v : u + Modulus - v;
+            }
+        }
+    }
+    if (inverse) {
+        const uint64_t length_inverse = u32_modular_power(static_cast<uint32_t>(length % Modulus), Modulus - 2, Modulus);
+        for (size_t i = 0; i < length; i++) {
+            a[i] = static_cast<uint32_t>(a[i] * length_inverse % Modulus);
+        }
+    }
+    return;
+}
+
+template<uint32_t Modulus>
+inline void u32_pointwise_multiplication(u32arr a, const u32arr b, const size_t length) noexcept {
+    for (size_t i = 0; i < length; i++) {
+        a[i] = static_cast<uint32_t>(static_cast<uint64_t>(a[i]) * b[i] % Modulus);
+    }
+    return;
+}
+
+inline void u32_number_theoretic_transform(u32arr a, const size_t length, const size_t prime_index, const bool inverse) {
+    switch(prime_index) {
+        case 0: u32_number_theoretic_transform<ntt_primes[0].modulus, ntt_primes[0].primitive_root>(a, length, inverse); break;
+        case 1: u32_number_theoretic_transform<ntt_primes[1].modulus, ntt_primes[1].primitive_root>(a, length, inverse); break;
+        case 2: u32_number_theoretic_transform<ntt_primes[2].modulus, ntt_primes[2].primitive_root>(a, length, inverse); break;
+        default: std::abort();
+    }
+    return;
+}
+
+inline void u32_pointwise_multiplication(u32arr a, const u32arr b, const size_t length, const size_t prime_index) noexcept {
+    switch(prime_index) {
+        case 0: u32_pointwise_multiplication<ntt_primes[0].modulus>(a, b, length); break;
+        case 1: u32_pointwise_multiplication<ntt_primes[1].modulus>(a, b, length); break;
+        case 2: u32_pointwise_multiplication<ntt_primes[2].modulus>(a, b, length); break;
+        default: std::abort();
+    }
+    return;
+}
+
+inline void u32_ntt_load(const uint64_t* source, u32arr target, const size_t length_source, const size_t length, const size_t prime_index) noexcept {
+    //Reduces the limbs modulo the prime and zero-pads the transform buffer up to length.
+    const uint32_t modulus = ntt_primes[prime_index].modulus;
+    for (size_t i = 0; i < length_source; i++) {
+        target[i] = static_cast<uint32_t>(source[i] % modulus);
+    }
+    std::fill(target + length_source, target + length, 0u);
+    return;
+}
+
+inline void u32_ntt_load(const uint64_t* source, u32arr target, const size_t length_source, const size_t length, const size_t prime_index, NativeRadix) noexcept {
+    //Splits every native limb into two 32-bit pieces (low piece first), the convolution is carried out in base 2 ^ 32.
+    const uint32_t modulus = ntt_primes[prime_index].modulus;
+    for (size_t i = 0; i < length_source; i++) {
+        target[i << 1] = static_cast<uint32_t>((source[i] & 0xffffffffull) % modulus);
+        target[(i << 1) | 1] = static_cast<uint32_t>((source[i] >> 32) % modulus);
+    }
+    std::fill(target + (length_source << 1), target + length, 0u);
+    return;
+}
+
+template<typename Radix>
+inline constexpr size_t u64_ntt_pieces_v = 1;
+
+template<>
+inline constexpr size_t u64_ntt_pieces_v<NativeRadix> = 2;
+
+template<uint64_t Base>
+inline constexpr size_t u64_ntt_pieces_v<WideRadix<Base>> = 2;
+
+template<uint64_t Base>
+inline void u32_ntt_load(const uint64_t* source, u32arr target, const size_t length_source, const size_t length, const size_t prime_index, WideRadix<Base>) noexcept {
+    //Splits every wide limb into two pieces of the piece base (low piece first), the convolution is carried out in the piece base.
+    constexpr uint64_t piece = WideRadix<Base>::piece;
+    const uint32_t modulus = ntt_primes[prime_index].modulus;
+    for (size_t i = 0; i < length_source; i++) {
+        target[i << 1] = static_cast<uint32_t>(source[i] % piece % modulus);
+        target[(i << 1) | 1] = static_cast<uint32_t>(source[i] / piece % modulus);
+    }
+    std::fill(target + (length_source << 1), target + length, 0u);
+    return;
+}
+
+inline unsigned __int128 u32_three_prime_crt(const uint32_t r0, const uint32_t r1, const uint32_t r2) noexcept {
+    //Garner's algorithm: x = r0 + p0 * v1 + p0 * p1 * v2 with 0 <= x < p0 * p1 * p2.
+    constexpr uint64_t p0 = ntt_primes[0].modulus, p1 = ntt_primes[1].modulus, p2 = ntt_primes[2].modulus;
+    constexpr uint64_t p0_inv_p1 = u32_modular_power(p0 % p1, p1 - 2, p1);
+    constexpr uint64_t p0_inv_p2 = u32_modular_power(p0 % p2, p2 - 2, p2);
+    constexpr uint64_t p1_inv_p2 = u32_modular_power(p1 % p2, p2 - 2, p2);
+    const uint64_t v1 = (r1 + p1 - r0 % p1) % p1 * p0_inv_p1 % p1;
+    const uint64_t v2 = ((r2 + p2 - r0 % p2) % p2 * p0_inv_p2 % p2 + p2 - v1 % p2) % p2 * p1_inv_p2 % p2;
+    return static_cast<unsigned __int128>(r0) + static_cast<unsigned __int128>(p0) * v1 + static_cast<unsigned __int128>(p0 * p1) * v2;
+}
+
+template<typename Radix>
+inline bool u32_ntt_recombine(const uint32_t* r0, const uint32_t* r1, const uint32_t* r2, const size_t transform_length, u64arr c, const size_t length, const Radix base) noexcept {
+    //Recovers the convolution coefficients by CRT and propagates their carries into c (length limbs). Returns true if the product exceeds c.
+    unsigned __int128 carry = 0;
+    bool flag = false;
+    for (size_t i = 0; i < transform_length; i++) {
+        carry += u32_three_prime_crt(r0[i], r1[i], r2[i]);
+        const uint64_t digit = static_cast<uint64_t>(carry % base);
+        carry /= base;
+        if (i < length) {
+            c[i] = digit;
+        } else {
+            flag |= digit != 0ull;
+        }
+    }
+    std::fill(c + std::min<size_t>(transform_length, length), c + length, 0ull);
+    return flag || carry != 0;
+}
+
+inline bool u32_ntt_recombine(const uint32_t* r0, const uint32_t* r1, const uint32_t* r2, const size_t transform_length, u64arr c, const size_t length, NativeRadix) noexcept {
+    //Native limbs are recombined from two base 2 ^ 32 pieces.
+    unsigned __int128 carry = 0;
+    bool flag = false;
+    uint64_t digit = 0ull;
+    for (size_t i = 0; i < transform_length; i++) {
+        carry += u32_three_prime_crt(r0[i], r1[i], r2[i]);
+        digit |= (static_cast<uint64_t>(carry) & 0xffffffffull) << ((i & 1) << 5);
+        carry >>= 32;
+        if ((i & 1) == 0) {
+            continue;
+        }
+        if ((i >> 1) < length) {
+            c[i >> 1] = digit;
+        } else {
+            flag |= digit != 0ull;
+        }
+        digit = 0ull;
+    }
+    std::fill(c + std::min<size_t>(transform_length >> 1, length), c + length, 0ull);
+    return flag || carry != 0;
+}
+
+template<uint64_t Base>
+inline bool u32_ntt_recombine(const uint32_t* r0, const uint32_t* r1, const uint32_t* r2, const size_t transform_length, u64arr c, const size_t length, WideRadix<Base>) noexcept {
+    //Wide limbs are recombined from two pieces, the carry (below 2 ^ 87) is split at the piece base without a 128-bit division.
+    constexpr uint64_t piece = WideRadix<Base>::piece;
+    unsigned __int128 carry = 0;
+    bool flag = false;
+    uint64_t digit = 0ull;
+    for (size_t i = 0; i < transform_length; i++) {
+        carry += u32_three_prime_crt(r0[i], r1[i], r2[i]);
+        uint64_t part;
+        carry = U128ConstantSplit<piece>::divide(carry, part);
+        if ((i & 1) == 0) {
+            digit = part;
+            continue;
+        }
+        digit += part * piece;
+        if ((i >> 1) < length) {
+            c[i >> 1] = digit;
+        } else {
+            flag |= digit != 0ull;
+        }
+    }
+    std::fill(c + std::min<size_t>(transform_length >> 1, length), c + length, 0ull);
+    return flag || carry != 0;
+}
+
+template<typename Radix>
+inline void u64_variable_length_integer_ntt_multiplication(const u64arr a, const u64arr b, u64arr c, const size_t length, const Radix base) {
+    /* Computes c = a * b serially by the three-prime NTT, where a and b hold length limbs and c holds (length << 1) limbs.
+       The transform length (twice as long for native and wide limbs) must not exceed 2 ^ ntt_max_log_length.
+       A square (b aliasing a) takes one forward transform per prime instead of two. */
+    constexpr size_t pieces = u64_ntt_pieces_v<Radix>;
+    const size_t transform_length = std::bit_ceil((length << 1) * pieces);
+    const bool square = a == b;
+    std::vector<uint32_t> transforms[ntt_prime_count], operand(square ? 0 : transform_length);
+    for (size_t k = 0; k < ntt_prime_count; k++) {
+        transforms[k].resize(transform_length);
+        if constexpr (pieces == 2) {
+            u32_ntt_load(a, transforms[k].data(), length, transform_length, k, base);
+        } else {
+            u32_ntt_load(a, transforms[k].data(), length, transform_length, k);
+        }
+        u32_number_theoretic_transform(transforms[k].data(), transform_length, k, false);
+        if (square) {
+            u32_pointwise_multiplication(transforms[k].data(), transforms[k].data(), transform_length, k);
+        } else {
+            if constexpr (pieces == 2) {
+                u32_ntt_load(b, operand.data(), length, transform_length, k, base);
+            } else {
+                u32_ntt_load(b, operand.data(), length, transform_length, k);
+            }
+            u32_number_theoretic_transform(operand.data(), transform_length, k, false);
+            u32_pointwise_multiplication(transforms[k].data(), operand.data(), transform_length, k);
+        }
+        u32_number_theoretic_transform(transforms[k].data(), transform_length, k, true);
+    }
+    u32_ntt_recombine(transforms[0].data(), transforms[1].data(), transforms[2].data(), transform_length, c, length << 1, base);
+    return;
+}
+
+}
@@ -0,0 +1,166 @@
+#pragma once
+
+#include <bit>
+
+#include "ArithmeticFunctions.hpp"
+
+namespace mpengine {
+
+/**
+ * @brief Kernels of the shifts by F = base ^ limbs * m, where the factor m divides the store base.
+ *
+ * Writing a limb as a = hi * (base / m) + lo, limb j of a * F is
+ *
+ *     lo(a[j - limbs]) * m + hi(a[j - limbs - 1]),
+ *
+ * which never exceeds base - 1, so there is no carry chain and every output limb reads two input limbs only.
+ * Symmetrically, limb j of floor(a / F) is a[j + limbs] / m + (a[j + limbs + 1] mod m) * (base / m).
+ * Any range of output limbs is thus computed independently (c must not alias a), the kernels are bandwidth-bound.
+ * Power-of-two bases (hex and oct compact, native) take masks and shifts, the native radix takes m = 2 ^ r.
+ */
+
+struct ShiftPlan {
+    //F = base ^ limbs * factor, direct is false when F does not take this form in the store base.
+    size_t limbs;
+    uint64_t factor;
+    bool direct;
+};
+
+template<typename Radix>
+inline ShiftPlan u64_shift_plan(const uint64_t unit, const size_t count, const Radix base) noexcept {
+    /* Decomposes unit ^ count for a unit of 2 or the io base. A binary base of w bits takes any power of two,
+       the decimal base takes decimal digits, and the bit shifts dividing the base (2 ^ 8 at most). */
+    if (std::has_single_bit<uint64_t>(base) && std::has_single_bit(unit)) {
+        const size_t width = std::countr_zero<uint64_t>(base), bits = count * std::countr_zero(unit);
+        return ShiftPlan{bits / width, 1ull << (bits % width), true};
+    }
+    uint64_t power = 1ull;
+    size_t digits = 0;
+    while (power * unit <= base && base % (power * unit) == 0ull) {
+        power *= unit;
+        digits++;
+    }
+    if (power == base) {
+        uint64_t factor = 1ull;
+        for (size_t i = 0; i < count % digits; i++) {
+            factor *= unit;
+        }
+        return ShiftPlan{count / digits, factor, true};
+    }
+    if (count <= digits) {
+        uint64_t factor = 1ull;
+        for (size_t i = 0; i < count; i++) {
+            factor *= unit;
+        }
+        return ShiftPlan{0, factor, true};
+    }
+    return ShiftPlan{0, 1ull, false};
+}
+
+inline ShiftPlan u64_shift_plan(const uint64_t unit, const size_t count, NativeRadix) noexcept {
+    if (std::has_single_bit(unit)) {
+        const size_t bits = count * std::countr_zero(unit);
+        return ShiftPlan{bits >> 6, 1ull << (bits & 63), true};
+    }
+    return ShiftPlan{0, 1ull, false};
+}
+
+template<typename Radix>
+inline void u64_variable_length_integer_shift_left(const u64arr a, u64arr c, const size_t begin, const size_t end, const size_t limbs, const uint64_t m, const Radix base) noexcept {
+    //Limbs [begin, end) of c = a * base ^ limbs * m (mod base ^ length).
+    const uint64_t n = base / m;
+    auto low = [&](size_t j) { return j >= limbs ? a[j - limbs] : 0ull; };
+    auto high = [&](size_t j) { return j > limbs ? a[j - limbs - 1] : 0ull; };
+    if (std::has_single_bit<uint64_t>(base)) {
+        const int shift = std::countr_zero(m), rest = std::countr_zero(n);
+        for (size_t j = begin; j < end; j++) {
+            c[j] = ((low(j) & (n - 1)) << shift) | (high(j) >> rest);
+        }
+    } else {
+        for (size_t j = begin; j < end; j++) {
+            c[j] = (low(j) % n) * m + high(j) / n;
+        }
+    }
+    return;
+}
+
+template<typename Radix>
+inline void u64_variable_length_integer_shift_right(const u64arr a, u64arr c, const size_t length, const size_t begin, const size_t end, const size_t limbs, const uint64_t m, const Radix base) noexcept {
+    //Limbs [begin, end) of c = floor(a / (base ^ limbs * m)), a holding length limbs.
+    const uint64_t n = base / m;
+    auto low = [&](size_t j) { return j + limbs < length ? a[j + limbs] : 0ull; };
+    auto high = [&](size_t j) { return j + limbs + 1 < length ? a[j + limbs + 1] : 0ull; };
+    if (std::has_single_bit<uint64_t>(base)) {
+        const int shift = std::countr_zero(m), rest = std::countr_zero(n);
+        for (size_t j = begin; j < end; j++) {
+            c[j] = (low(j) >> shift) | ((high(j) & (m - 1)) << rest);
+        }
+    } else {
+        for (size_t j = begin; j < end; j++) {
+            c[j] = low(j) / m + (high(j) % m) * n;
+        }
+    }
+    return;
+}
+
+template<typename Radix>
+inline bool u64_variable_length_integer_shift_left_overflow(const u64arr a, const size_t length, const size_t limbs, const uint64_t m, const Radix base) noexcept {
+    //Whether a * base ^ limbs * m exceeds length limbs.
+    if (limbs >= length) {
+        return std::any_of(a, a + length, [](uint64_t limb) { return limb != 0ull; });
+    }
+    return std::any_of(a + length - limbs, a + length, [](uint64_t limb) { return limb != 0ull; }) || a[length - limbs - 1] / (base / m) != 0ull;
+}
+
+inline void u64_variable_length_integer_shift_left(const u64arr a, u64arr c, const size_t begin, const size_t end, const size_t limbs, const uint64_t m, NativeRadix) noexcept {
+    const int shift = std::countr_zero(m);
+    auto low = [&](size_t j) { return j >= limbs ? a[j - limbs] : 0ull; };
+    auto high = [&](size_t j) { return j > limbs ? a[j - limbs - 1] : 0ull; };
+    if (shift == 0) {
+        for (size_t j = begin; j < end; j++) {
+            c[j] = low(j);
+        }
+        return;
+    }
+    for (size_t j = begin; j < end; j++) {
+        c[j] = (low(j) << shift) | (high(j) >> (64 - shift));
+    }
+    return;
+}
+
+inline void u64_variable_length_integer_shift_right(const u64arr a, u64arr c, const size_t length, const size_t begin, const size_t end, const size_t limbs, const uint64_t m, NativeRadix) noexcept {
+    const int shift = std::countr_zero(m);
+    auto low = [&](size_t j) { return j + limbs < length ? a[j + limbs] : 0ull; };
+    auto high = [&](size_t j) { return j + limbs + 1 < length ? a[j + limbs + 1] : 0ull; };
+    if (shift == 0) {
+        for (size_t j = begin; j < end; j++) {
+            c[j] = low(j);
+        }
+        return;
+    }
+    for (size_t j = begin; j < end; j++) {
+        c[j] = (low(j) >> shift) | (high(j) << (64 - shift));
+    }
+    return;
+}
+
+inline bool u64_variable_length_integer_shift_left_overflow(const u64arr a, const size_t length, const size_t limbs, const uint64_t m, NativeRadix) noexcept {
+    if (limbs >= length) {
+        return std::any_of(a, a + length, [](uint64_t limb) { return limb != 0ull; });
+    }
+    const int shift = std::countr_zero(m);
+    return std::any_of(a + length - limbs, a + length, [](uint64_t limb) { return limb != 0ull; }) || (shift != 0 && (a[length - limbs - 1] >> (64 - shift)) != 0ull);
+}
+
+inline uint64_t u64_shift_step_factor(const uint64_t unit, size_t& exponent) noexcept {
+    //The largest power unit ^ exponent below 2 ^ 64, the step of the shifts by repeated scalar passes.
+    uint64_t factor = 1ull;
+    exponent = 0;
+    while (factor <= UINT64_MAX / unit) {
+        factor *= unit;
+        exponent++;
+    }
+    return factor;
+}
+
+}
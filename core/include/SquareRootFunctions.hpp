@@ -0,0 +1,143 @@
+#pragma once
+
+#include <cmath>
+
+#include "DivisionFunctions.hpp"
+
+namespace mpengine {
+
+/**
+ * @brief Kernels of the integer square root by Newton iteration on the reciprocal square root.
+ *
+ * The operand N of 2n limbs (a zero limb on top for an odd length) is extended by 4 zero limbs below,
+ * so that N' = N * base ^ 4 holds 2P limbs with P = n + 2. For a precision of h limbs, M_h denotes the
+ * leading 2h limbs of N' and Y_h approximates base ^ 2h / sqrt(M_h) within a few units. One iteration
+ * from h to H limbs (H <= 2h - 2) is the Newton step of y' = y + y * (1 - M * y ^ 2) / 2 in fixed point:
+ *
+ *     E = base ^ (2H + 2h) - M_H * Y_h ^ 2,    Y_H = Y_h * base ^ (H - h) + Y_h * E / (2 * base ^ (H + 3h))
+ *
+ * Finally sqrt(N) = N * Y_P / base ^ (2n + 2) up to a few units, corrected by the exact remainder.
+ */
+
+inline std::vector<size_t> u64_sqrt_precision_ladder(const size_t precision) {
+    /* The first reciprocal square root holds two limbs and is computed in floating point, which is accurate
+       to about 64 bits only, so it is refined once at the same precision before the precision doubles. */
+    std::vector<size_t> ladder = u64_newton_precision_ladder(std::max<size_t>(precision, 2), 2);
+    ladder.insert(ladder.begin(), ladder.front());
+    return ladder;
+}
+
+constexpr size_t u64_sqrt_scratch_length(const size_t precision) noexcept {
+    //Scratch limbs required by u64_reciprocal_sqrt_newton_step up to the given precision.
+    return 15 * precision + 24;
+}
+
+template<typename Radix>
+inline size_t u64_reciprocal_sqrt_initial(const u64arr m, u64arr y, const Radix base) noexcept {
+    /* Y_2 = base ^ 4 / sqrt(M_2) in floating point, M_2 being the four limbs of m (the leading one may be zero).
+       y receives 4 limbs, returns the length of Y_2. */
+    const long double beta = static_cast<long double>(u64_radix_value(base));
+    long double value = 0.0l, power = beta * beta * beta;
+    for (size_t i = 4; i-- > 0; ) {
+        value = value * beta + static_cast<long double>(m[i]);
+    }
+    long double estimate = power * beta / std::sqrt(std::max<long double>(value, 1.0l));
+    estimate = std::min<long double>(estimate, power * beta - 1.0l);
+    for (size_t i = 4; i-- > 0; power /= beta) {
+        const long double limb = std::clamp<long double>(std::floor(estimate / power), 0.0l, beta - 1.0l);
+        y[i] = static_cast<uint64_t>(limb);
+        estimate = std::max<long double>(estimate - limb * power, 0.0l);
+    }
+    return u64_variable_length_integer_significant_length(y, 4);
+}
+
+template<typename Radix>
+inline size_t u64_reciprocal_sqrt_newton_step(const u64arr m, const size_t H, u64arr y, const size_t length_y, const size_t h, u64arr scratch, const Radix base, const size_t karatsuba_threshold, const size_t ntt_threshold) {
+    /* One iteration from Y_h (length_y <= h + 2 limbs in y) to Y_H (written back to y, at most H + 2 limbs),
+       where m holds M_H (2H limbs). Returns the length of Y_H. */
+    const size_t width = (H << 1) + (h << 1) + 5;
+    u64arr square = scratch, product = square + (length_y << 1), residual = product + width, correction = residual + width;
+    u64_variable_length_integer_unbalanced_multiplication(y, y, square, length_y, length_y, base, karatsuba_threshold, ntt_threshold);
+    const size_t length_square = u64_variable_length_integer_significant_length(square, length_y << 1);
+    u64_variable_length_integer_unbalanced_multiplication(m, square, product, H << 1, length_square, base, karatsuba_threshold, ntt_threshold);
+    std::fill(product + (H << 1) + length_square, product + width, 0ull);
+    //E = base ^ (2H + 2h) - M_H * Y_h ^ 2 by magnitude and sign.
+    std::fill(residual, residual + width, 0ull);
+    residual[(H << 1) + (h << 1)] = 1ull;
+    const bool negative = u64_variable_length_integer_compare(product, residual, width) > 0;
+    if (negative) {
+        u64_variable_length_integer_subtraction_in_place(product, residual, width, width, base);
+        std::copy(product, product + width, residual);
+    } else {
+        u64_variable_length_integer_subtraction_in_place(residual, product, width, width, base);
+    }
+    const size_t length_residual = u64_variable_length_integer_significant_length(residual, width);
+    u64_variable_length_integer_unbalanced_multiplication(y, residual, correction, length_y, length_residual, base, karatsuba_threshold, ntt_threshold);
+    //The correction Y_h * E / (2 * base ^ (H + 3h)) is shifted into the product buffer.
+    const size_t shift = H + 3 * h, length_correction = length_y + length_residual;
+    const size_t length_shifted = length_correction > shift ? length_correction - shift : 0;
+    std::copy(correction + shift, correction + shift + length_shifted, product);
+    u64_variable_length_integer_division_by_small(product, length_shifted, 2ull, base);
+    std::copy_backward(y, y + length_y, y + length_y + (H - h));
+    std::fill(y, y + (H - h), 0ull);
+    std::fill(y + length_y + (H - h), y + H + 2, 0ull);
+    const size_t span = std::min<size_t>(length_shifted, H + 2);
+    if (negative) {
+        u64_variable_length_integer_subtraction_in_place(y, product, H + 2, span, base);
+    } else {
+        u64_variable_length_integer_addition_in_place(y, product, H + 2, span, base);
+    }
+    return u64_variable_length_integer_significant_length(y, H + 2);
+}
+
+template<typename Radix>
+inline void u64_variable_length_integer_sqrt_correction(const u64arr n, const size_t length_n, u64arr s, const size_t length_s, u64arr r, u64arr scratch, const Radix base, const size_t karatsuba_threshold, const size_t ntt_threshold) {
+    /* Corrects the estimate s (length_s limbs, off by a few units) to floor(sqrt(n)) and writes the remainder n - s ^ 2 into r.
+       r and scratch hold (max(length_n, 2 * length_s) + length_s + 2) limbs. */
+    uint64_t one = 1ull;
+    const size_t width = std::max<size_t>(length_n, length_s << 1) + 1;
+    u64arr square = scratch, twice = square + width;
+    u64_variable_length_integer_unbalanced_multiplication(s, s, square, length_s, length_s, base, karatsuba_threshold, ntt_threshold);
+    std::fill(square + (length_s << 1), square + width, 0ull);
+    std::copy(n, n + length_n, r);
+    std::fill(r + length_n, r + width, 0ull);
+    auto double_s = [&](bool plus) {
+        //twice = 2s +/- 1.
+        std::fill(twice, twice + length_s + 1, 0ull);
+        u64_variable_length_integer_multiply_add_small(twice, s, length_s + 1, length_s, 2ull, base);
+        if (plus) {
+            u64_variable_length_integer_addition_in_place(twice, &one, length_s + 1, 1, base);
+        } else {
+            u64_variable_length_integer_subtraction_in_place(twice, &one, length_s + 1, 1, base);
+        }
+    };
+    if (u64_variable_length_integer_compare(square, r, width) > 0) {
+        //s ^ 2 - (s - 1) ^ 2 = 2s - 1.
+        u64_variable_length_integer_subtraction_in_place(square, r, width, width, base);
+        while (true) {
+            double_s(false);
+            u64_variable_length_integer_subtraction_in_place(s, &one, length_s, 1, base);
+            if (u64_variable_length_integer_compare_unbalanced(square, width, twice, length_s + 1) <= 0) {
+                std::fill(r, r + width, 0ull);
+                std::copy(twice, twice + length_s + 1, r);
+                u64_variable_length_integer_subtraction_in_place(r, square, width, width, base);
+                break;
+            }
+            u64_variable_length_integer_subtraction_in_place(square, twice, width, length_s + 1, base);
+        }
+    } else {
+        //(s + 1) ^ 2 - s ^ 2 = 2s + 1.
+        u64_variable_length_integer_subtraction_in_place(r, square, width, width, base);
+        while (true) {
+            double_s(true);
+            if (u64_variable_length_integer_compare_unbalanced(r, width, twice, length_s + 1) < 0) {
+                break;
+            }
+            u64_variable_length_integer_subtraction_in_place(r, twice, width, length_s + 1, base);
+            u64_variable_length_integer_addition_in_place(s, &one, length_s, 1, base);
+        }
+    }
+    return;
+}
+
+}
@@ -0,0 +1,156 @@
+#pragma once
+
+#include "ArithmeticFunctions.hpp"
+
+namespace mpengine {
+
+/**
+ * @struct ToomCookScheme
+ * @brief Evaluation points and exact interpolation matrix of a Toom-Cook way.
+ *
+ * An operand of n limbs is split into `way` parts of part_length = ceil(n / way) limbs,
+ * i.e. the coefficients of a polynomial evaluated at x = base ^ part_length.
+ * The product polynomial has `points` = 2 * way - 1 coefficients, which are recovered from the
+ * pointwise products at the finite evaluation points and at infinity (the product of the leading parts):
+ *
+ *     coefficient[j] = sum(interpolation[j][i] * product[i]) / denominators[j]
+ *
+ * The matrix rows are the inverse Vandermonde matrix scaled by the row denominators, every division is exact.
+ */
+
+struct ToomCookScheme {
+    static constexpr const size_t MAX_POINTS = 7;
+    size_t way;
+    size_t points;
+    int64_t evaluation_points[MAX_POINTS - 1];
+    int64_t interpolation[MAX_POINTS][MAX_POINTS];
+    uint64_t denominators[MAX_POINTS];
+};
+
+inline constexpr const ToomCookScheme toom3_scheme = {
+    3, 5,
+    {0, 1, -1, 2},
+    {
+        {  1,  0,  0,  0,   0},
+        { -3,  6, -2, -1,  12},
+        { -2,  1,  1,  0,  -2},
+        {  3, -3, -1,  1, -12},
+        {  0,  0,  0,  0,   1}
+    },
+    {1, 6, 2, 6, 1}
+};
+
+inline constexpr const ToomCookScheme toom4_scheme = {
+    4, 7,
+    {0, 1, -1, 2, -2, 3},
+    {
+        {  1,   0,   0,   0,  0,  0,    0},
+        {-20,  60, -30, -15,  3,  2, -720},
+        {-30,  16,  16,  -1, -1,  0,   96},
+        { 10, -14,  -1,   7, -1, -1,  360},
+        {  6,  -4,  -4,   1,  1,  0, -120},
+        {-10,  10,   5,  -5, -1,  1, -360},
+        {  0,   0,   0,   0,  0,  0,    1}
+    },
+    {1, 60, 24, 24, 24, 120, 1}
+};
+
+constexpr size_t u64_toom_cook_part_length(const size_t length, const ToomCookScheme& scheme) noexcept {
+    return (length + scheme.way - 1) / scheme.way;
+}
+
+template<typename Radix>
+inline void u64_toom_cook_evaluate(const u64arr a, const size_t length, const ToomCookScheme& scheme, u64arr values, bool* signs, u64arr scratch, const Radix base) noexcept {
+    /* Evaluates the split operand at every point of the scheme.
+       values holds scheme.points slots of (part_length + 1) limbs, scratch holds (part_length + 1) limbs.
+       Finite points are evaluated as even part +/- odd part, so both signs of a point share the same powers. */
+    const size_t part = u64_toom_cook_part_length(length, scheme), width = part + 1;
+    auto part_length = [&](size_t i) -> size_t {
+        return i * part >= length ? 0 : std::min<size_t>(part, length - i * part);
+    };
+    for (size_t p = 0; p + 1 < scheme.points; p++) {
+        u64arr value = values + p * width;
+        const int64_t x = scheme.evaluation_points[p];
+        const uint64_t magnitude = static_cast<uint64_t>(x < 0 ? -x : x);
+        std::fill(value, value + width, 0ull);
+        std::fill(scratch, scratch + width, 0ull);
+        uint64_t power = 1ull;
+        for (size_t i = 0; i < scheme.way && (i == 0 || magnitude != 0ull); i++, power *= magnitude) {
+            u64arr target = (i & 1) ? scratch : value;
+            u64_variable_length_integer_multiply_add_small(target, a + i * part, width, part_length(i), power, base);
+        }
+        signs[p] = true;
+        u64_variable_length_integer_signed_addition_in_place(value, signs[p], scratch, x >= 0, width, base);
+    }
+    u64arr value = values + (scheme.points - 1) * width;
+    const size_t leading = part_length(scheme.way - 1);
+    std::copy(a + (scheme.way - 1) * part, a + (scheme.way - 1) * part + leading, value);
+    std::fill(value + leading, value + width, 0ull);
+    signs[scheme.points - 1] = true;
+    return;
+}
+
+template<typename Radix>
+inline void u64_toom_cook_interpolate(const u64arr products, const bool* signs, const size_t product_length, const ToomCookScheme& scheme, const size_t j, u64arr coefficient, u64arr scratch, const Radix base) noexcept {
+    /* Recovers the j-th coefficient of the product polynomial from the signed pointwise products,
+       each product holding product_length limbs. coefficient and scratch hold (product_length + 1) limbs. */
+    const size_t width = product_length + 1;
+    bool sign = true;
+    std::fill(coefficient, coefficient + width, 0ull);
+    for (size_t i = 0; i < scheme.points; i++) {
+        const int64_t m = scheme.interpolation[j][i];
+        if (m == 0) {
+            continue;
+        }
+        std::fill(scratch, scratch + width, 0ull);
+        u64_variable_length_integer_multiply_add_small(scratch, products + i * product_length, width, product_length, static_cast<uint64_t>(m < 0 ? -m : m), base);
+        u64_variable_length_integer_signed_addition_in_place(coefficient, sign, scratch, signs[i] == (m > 0), width, base);
+    }
+    //The coefficients of a product of non-negative polynomials are non-negative.
+    assert(sign || std::all_of(coefficient, coefficient + width, [](uint64_t limb) { return limb == 0ull; }));
+    u64_variable_length_integer_division_by_small(coefficient, width, scheme.denominators[j], base);
+    return;
+}
+
+template<typename Radix>
+inline void u64_toom_cook_compose(u64arr c, const u64arr coefficient, const size_t length, const size_t product_length, const size_t offset, const Radix base) noexcept {
+    //Adds a recovered coefficient of (product_length + 1) limbs to c (length limbs) at offset, the limbs beyond c are zeros.
+    if (offset >= length) {
+        return;
+    }
+    const size_t span = std::min<size_t>(product_length + 1, length - offset);
+    u64_variable_length_integer_addition_in_place(c + offset, coefficient, length - offset, span, base);
+    return;
+}
+
+constexpr size_t u64_toom_cook_scratch_length(const size_t length, const ToomCookScheme& scheme, const size_t threshold) noexcept {
+    //Scratch limbs required by u64_variable_length_integer_toom_cook_multiplication.
+    const size_t width = u64_toom_cook_part_length(length, scheme) + 1, product_length = width << 1;
+    return ((scheme.points * width) << 1) + scheme.points * product_length + ((product_length + 1) << 1) + u64_karatsuba_scratch_length(width, threshold);
+}
+
+template<typename Radix>
+inline void u64_variable_length_integer_toom_cook_multiplication(const u64arr a, const u64arr b, u64arr c, const size_t length, const ToomCookScheme& scheme, const Radix base, u64arr scratch, const size_t threshold) noexcept {
+    /* Computes c = a * b, where a and b hold length limbs and c holds (length << 1) limbs.
+       The pointwise products are computed by the Karatsuba kernel. */
+    const size_t part = u64_toom_cook_part_length(length, scheme), width = part + 1, product_length = width << 1;
+    u64arr values_A = scratch, values_B = values_A + scheme.points * width;
+    u64arr products = values_B + scheme.points * width;
+    u64arr coefficient = products + scheme.points * product_length, temporary = coefficient + product_length + 1;
+    u64arr next = temporary + product_length + 1;
+    bool signs_A[ToomCookScheme::MAX_POINTS], signs_B[ToomCookScheme::MAX_POINTS], signs[ToomCookScheme::MAX_POINTS];
+    u64_toom_cook_evaluate(a, length, scheme, values_A, signs_A, temporary, base);
+    u64_toom_cook_evaluate(b, length, scheme, values_B, signs_B, temporary, base);
+    for (size_t i = 0; i < scheme.points; i++) {
+        u64_variable_length_integer_karatsuba_multiplication(values_A + i * width, values_B + i * width, products + i * product_length, width, base, next, threshold);
+        signs[i] = signs_A[i] == signs_B[i];
+    }
+    std::fill(c, c + (length << 1), 0ull);
+    for (size_t j = 0; j < scheme.points; j++) {
+        u64_toom_cook_interpolate(products, signs, product_length, scheme, j, coefficient, temporary, base);
+        u64_toom_cook_compose(c, coefficient, length << 1, product_length, j * part, base);
+    }
+    return;
+}
+
+}
@@ -0,0 +1,215 @@
+#pragma once
+
+#include <cstdint>
+#include <cstdlib>
+#if defined(__x86_64__)
+#include <immintrin.h>
+#endif
+
+namespace mpengine {
+
+/**
+ * @brief AVX2 / AVX-512 kernels of the compact radix add, subtract and compare loops.
+ *
+ * Compact limbs are far below 2 ^ 63, so a block of limbs is added (subtracted) lane-wise without overflow,
+ * and only the carries (borrows) between the lanes remain. Per block, every lane either generates a carry
+ * (sum >= base, resp. a < b) or propagates an incoming one (sum == base - 1, resp. a == b), and the carries
+ * into all the lanes are resolved at once from the two lane masks as in a carry-lookahead adder:
+ *
+ *     carries = (((generate << 1) | carry) + propagate) ^ propagate
+ *
+ * Bit i of carries is the carry into lane i, the bit above the last lane is the carry out of the block.
+ * The kernels are compiled for their instruction sets through target attributes and selected at runtime
+ * by simd_level(), so the library itself is still built for the baseline architecture.
+ */
+
+enum class SIMDLevel { scalar, avx2, avx512 };
+
+inline constexpr const size_t simd_min_length = 16;
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define MPENGINE_SIMD_KERNELS_AVAILABLE
+
+inline SIMDLevel simd_level() noexcept {
+    static const SIMDLevel level = [] {
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx512f")) {
+            return SIMDLevel::avx512;
+        } else if (__builtin_cpu_supports("avx2")) {
+            return SIMDLevel::avx2;
+        }
+        return SIMDLevel::scalar;
+    }();
+    return level;
+}
+
+struct AVX2LaneMasks {
+    //All-ones lanes selected by a 4-bit lane mask.
+    alignas(32) uint64_t lanes[16][4];
+    constexpr AVX2LaneMasks(): lanes() {
+        for (size_t mask = 0; mask < 16; mask++) {
+            for (size_t lane = 0; lane < 4; lane++) {
+                lanes[mask][lane] = (mask >> lane) & 1 ? ~0ull : 0ull;
+            }
+        }
+    }
+};
+
+inline constexpr const AVX2LaneMasks avx2_lane_masks;
+
+__attribute__((target("avx2")))
+inline __m256i avx2_lane_mask(const unsigned mask) noexcept {
+    return _mm256_load_si256(reinterpret_cast<const __m256i*>(avx2_lane_masks.lanes[mask]));
+}
+
+__attribute__((target("avx2")))
+inline bool u64_avx2_addition_with_carry(const uint64_t* a, const uint64_t* b, uint64_t* c, const size_t length, const uint64_t base) noexcept {
+    const __m256i base_v = _mm256_set1_epi64x(static_cast<int64_t>(base));
+    const __m256i limit_v = _mm256_set1_epi64x(static_cast<int64_t>(base - 1));
+    unsigned carry = 0;
+    size_t i = 0;
+    for (; i + 4 <= length; i += 4) {
+        __m256i sum = _mm256_add_epi64(
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i)),
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i))
+        );
+        const unsigned generate = _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpgt_epi64(sum, limit_v)));
+        const unsigned propagate = _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(sum, limit_v)));
+        const unsigned carries = (((generate << 1) | carry) + propagate) ^ propagate;
+        //Adding an all-ones lane is subtracting one.
+        sum = _mm256_sub_epi64(sum, avx2_lane_mask(carries & 0xf));
+        sum = _mm256_sub_epi64(sum, _mm256_and_si256(avx2_lane_mask((carries >> 1) & 0xf), base_v));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(c + i), sum);
+        carry = (carries >> 4) & 1;
+    }
+    for (; i < length; i++) {
+        c[i] = a[i] + b[i] + carry;
+        carry = c[i] >= base;
+        c[i] = carry ? c[i] - base : c[i];
+    }
+    return carry != 0;
+}
+
+__attribute__((target("avx2")))
+inline bool u64_avx2_subtraction_with_carry(const uint64_t* a, const uint64_t* b, uint64_t* c, const size_t length, const uint64_t base) noexcept {
+    const __m256i base_v = _mm256_set1_epi64x(static_cast<int64_t>(base));
+    unsigned borrow = 0;
+    size_t i = 0;
+    for (; i + 4 <= length; i += 4) {
+        const __m256i va = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+        const __m256i vb = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i));
+        const unsigned generate = _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpgt_epi64(vb, va)));
+        const unsigned propagate = _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(va, vb)));
+        const unsigned borrows = (((generate << 1) | borrow) + propagate) ^ propagate;
+        __m256i difference = _mm256_sub_epi64(va, vb);
+        difference = _mm256_add_epi64(difference, avx2_lane_mask(borrows & 0xf));
+        difference = _mm256_add_epi64(difference, _mm256_and_si256(avx2_lane_mask((borrows >> 1) & 0xf), base_v));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(c + i), difference);
+        borrow = (borrows >> 4) & 1;
+    }
+    for (; i < length; i++) {
+        const uint64_t subtrahend = b[i] + borrow;
+        borrow = a[i] < subtrahend;
+        c[i] = borrow ? a[i] + base - subtrahend : a[i] - subtrahend;
+    }
+    return borrow != 0;
+}
+
+__attribute__((target("avx2")))
+inline int u64_avx2_compare(const uint64_t* a, const uint64_t* b, const size_t length) noexcept {
+    size_t i = length;
+    for (; i >= 4; i -= 4) {
+        const unsigned equal = _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i - 4)),
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i - 4))
+        )));
+        if (equal != 0xf) {
+            const size_t j = i - 4 + (31 - __builtin_clz(~equal & 0xf));
+            return a[j] > b[j] ? 1 : -1;
+        }
+    }
+    while (i-- > 0) {
+        if (a[i] != b[i]) {
+            return a[i] > b[i] ? 1 : -1;
+        }
+    }
+    return 0;
+}
+
+__attribute__((target("avx512f")))
+inline bool u64_avx512_addition_with_carry(const uint64_t* a, const uint64_t* b, uint64_t* c, const size_t length, const uint64_t base) noexcept {
+    const __m512i base_v = _mm512_set1_epi64(static_cast<int64_t>(base));
+    const __m512i limit_v = _mm512_set1_epi64(static_cast<int64_t>(base - 1));
+    const __m512i one_v = _mm512_set1_epi64(1);
+    unsigned carry = 0;
+    size_t i = 0;
+    for (; i + 8 <= length; i += 8) {
+        __m512i sum = _mm512_add_epi64(_mm512_loadu_si512(a + i), _mm512_loadu_si512(b + i));
+        const unsigned generate = _mm512_cmpgt_epu64_mask(sum, limit_v);
+        const unsigned propagate = _mm512_cmpeq_epu64_mask(sum, limit_v);
+        const unsigned carries = (((generate << 1) | carry) + propagate) ^ propagate;
+        sum = _mm512_mask_add_epi64(sum, static_cast<__mmask8>(carries), sum, one_v);
+        sum = _mm512_mask_sub_epi64(sum, static_cast<__mmask8>(carries >> 1), sum, base_v);
+        _mm512_storeu_si512(c + i, sum);
+        carry = (carries >> 8) & 1;
+    }
+    for (; i < length; i++) {
+        c[i] = a[i] + b[i] + carry;
+        carry = c[i] >= base;
+        c[i] = carry ? c[i] - base : c[i];
+    }
+    return carry != 0;
+}
+
+__attribute__((target("avx512f")))
+inline bool u64_avx512_subtraction_with_carry(const uint64_t* a, const uint64_t* b, uint64_t* c, const size_t length, const uint64_t base) noexcept {
+    const __m512i base_v = _mm512_set1_epi64(static_cast<int64_t>(base));
+    const __m512i one_v = _mm512_set1_epi64(1);
+    unsigned borrow = 0;
+    size_t i = 0;
+    for (; i + 8 <= length; i += 8) {
+        const __m512i va = _mm512_loadu_si512(a + i), vb = _mm512_loadu_si512(b + i);
+        const unsigned generate = _mm512_cmplt_epu64_mask(va, vb);
+        const unsigned propagate = _mm512_cmpeq_epu64_mask(va, vb);
+        const unsigned borrows = (((generate << 1) | borrow) + propagate) ^ propagate;
+        __m512i difference = _mm512_sub_epi64(va, vb);
+        difference = _mm512_mask_sub_epi64(difference, static_cast<__mmask8>(borrows), difference, one_v);
+        difference = _mm512_mask_add_epi64(difference, static_cast<__mmask8>(borrows >> 1), difference, base_v);
+        _mm512_storeu_si512(c + i, difference);
+        borrow = (borrows >> 8) & 1;
+    }
+    for (; i < length; i++) {
+        const uint64_t subtrahend = b[i] + borrow;
+        borrow = a[i] < subtrahend;
+        c[i] = borrow ? a[i] + base - subtrahend : a[i] - subtrahend;
+    }
+    return borrow != 0;
+}
+
+__attribute__((target("avx512f")))
+inline int u64_avx512_compare(const uint64_t* a, const uint64_t* b, const size_t length) noexcept {
+    size_t i = length;
+    for (; i >= 8; i -= 8) {
+        const unsigned equal = _mm512_cmpeq_epu64_mask(_mm512_loadu_si512(a + i - 8), _mm512_loadu_si512(b + i - 8));
+        if (equal != 0xff) {
+            const size_t j = i - 8 + (31 - __builtin_clz(~equal & 0xff));
+            return a[j] > b[j] ? 1 : -1;
+        }
+    }
+    while (i-- > 0) {
+        if (a[i] != b[i]) {
+            return a[i] > b[i] ? 1 : -1;
+        }
+    }
+    return 0;
+}
+
+#else
+
+constexpr SIMDLevel simd_level() noexcept {
+    return SIMDLevel::scalar;
+}
+
+#endif
+
+}
@@ -1,6 +1,11 @@
 #pragma once
 
 #include <memory>
+#include <cstdint>
+#include <tuple>
+#include <functional>
+#include <vector>
+#include <utility>
 #include <iostream>
 
 #include "IOBasic.hpp"
@@ -20,7 +25,7 @@ private:
     friend void collect_graph_details(std::ostream& stream, const std::shared_ptr<IntegerDAGContext::Field>& field) noexcept;
     friend void collect_proce_details(std::ostream& stream, const std::shared_ptr<IntegerDAGContext::Field>& field) noexcept;
 public:
-    IntegerDAGContext(size_t precision = 0, IOBasic iobasic = IOBasic::dec);
+    IntegerDAGContext(size_t precision = 0, IOBasic iobasic = IOBasic::dec, StoreRadix radix = StoreRadix::compact);
     ~IntegerDAGContext();
     IntegerDAGContext(const IntegerDAGContext& context);
     IntegerDAGContext& operator = (const IntegerDAGContext& context);
@@ -34,6 +39,8 @@ private:
 #endif
     void export_graph_details(const char* dir_base_path);
     void nodes_sort();
+    void grow_precision();
+    void fuse_multiply_add();
     void generate_procedures();
     void await_pipeline_accomplish();
     void clean_up();
@@ -52,6 +59,29 @@ private:
     friend void collect_proce_details(std::ostream& stream, const std::shared_ptr<IntegerDAGContext::Field>& field) noexcept;
     friend std::ostream& operator << (std::ostream& stream, const IntegerVarReference& integer_ref) noexcept;
     friend IntegerVarReference operator + (IntegerVarReference& integer_A, IntegerVarReference& integer_B);
+    friend IntegerVarReference operator - (IntegerVarReference& integer_A, IntegerVarReference& integer_B);
+    friend IntegerVarReference operator - (IntegerVarReference& integer);
+    friend IntegerVarReference operator * (IntegerVarReference& integer_A, IntegerVarReference& integer_B);
+    friend IntegerVarReference operator / (IntegerVarReference& integer_A, IntegerVarReference& integer_B);
+    friend IntegerVarReference operator % (IntegerVarReference& integer_A, IntegerVarReference& integer_B);
+    friend IntegerVarReference operator * (IntegerVarReference& integer, uint64_t scalar);
+    friend IntegerVarReference operator * (uint64_t scalar, IntegerVarReference& integer);
+    friend IntegerVarReference operator / (IntegerVarReference& integer, uint64_t scalar);
+    friend IntegerVarReference operator % (IntegerVarReference& integer, uint64_t scalar);
+    friend IntegerVarReference operator << (IntegerVarReference& integer, size_t bits);
+    friend IntegerVarReference operator >> (IntegerVarReference& integer, size_t bits);
+    friend IntegerVarReference sum(const std::vector<IntegerVarReference>& integers);
+    friend IntegerVarReference product(const std::vector<IntegerVarReference>& integers);
+    friend IntegerVarReference digit_shift_left(IntegerVarReference& integer, size_t digits);
+    friend IntegerVarReference digit_shift_right(IntegerVarReference& integer, size_t digits);
+    friend std::pair<IntegerVarReference, IntegerVarReference> isqrt(IntegerVarReference& integer);
+    friend IntegerVarReference powmod(IntegerVarReference& integer_A, IntegerVarReference& integer_B, IntegerVarReference& integer_M);
+    friend IntegerVarReference gcd(IntegerVarReference& integer_A, IntegerVarReference& integer_B);
+    friend std::tuple<IntegerVarReference, IntegerVarReference, IntegerVarReference> gcdext(IntegerVarReference& integer_A, IntegerVarReference& integer_B);
+    friend IntegerVarReference cmp(IntegerVarReference& integer_A, IntegerVarReference& integer_B);
+    friend IntegerVarReference operator < (IntegerVarReference& integer_A, IntegerVarReference& integer_B);
+    friend IntegerVarReference operator == (IntegerVarReference& integer_A, IntegerVarReference& integer_B);
+    friend IntegerVarReference select(IntegerVarReference& integer_P, IntegerVarReference& integer_A, IntegerVarReference& integer_B);
 public:
     IntegerVarReference(const char* integer_str, IntegerDAGContext& context);
     IntegerVarReference(const char* integer_str, IntegerDAGContext&& context);
@@ -63,12 +93,60 @@ public:
     IntegerDAGContext get_context() const;
 };
 
+IntegerVarReference sum(const std::vector<IntegerVarReference>& integers);
+IntegerVarReference digit_shift_left(IntegerVarReference& integer, size_t digits);
+IntegerVarReference digit_shift_right(IntegerVarReference& integer, size_t digits);
+std::pair<IntegerVarReference, IntegerVarReference> isqrt(IntegerVarReference& integer);
+IntegerVarReference powmod(IntegerVarReference& integer_A, IntegerVarReference& integer_B, IntegerVarReference& integer_M);
+IntegerVarReference gcd(IntegerVarReference& integer_A, IntegerVarReference& integer_B);
+std::tuple<IntegerVarReference, IntegerVarReference, IntegerVarReference> gcdext(IntegerVarReference& integer_A, IntegerVarReference& integer_B);
+IntegerVarReference cmp(IntegerVarReference& integer_A, IntegerVarReference& integer_B);
+IntegerVarReference select(IntegerVarReference& integer_P, IntegerVarReference& integer_A, IntegerVarReference& integer_B);
+
+/**
+ * @struct SeriesTerm
+ * @brief The n-th step of a series S = sum a(n) * p(begin) * ... * p(n) / (q(begin) * ... * q(n)).
+ *
+ * The generator of binary_splitting() returns p(n), q(n) and a(n) as integers of the context, so
+ * that coefficients beyond 64 bits are built with the nodes of the context as well.
+ */
+
+struct SeriesTerm {
+    IntegerVarReference p, q, a;
+};
+
+using SeriesGenerator = std::function<SeriesTerm(IntegerDAGContext& context, uint64_t n)>;
+
+//Returns Q and T with S = T / Q over the terms [begin, end), as a balanced tree of products.
+std::pair<IntegerVarReference, IntegerVarReference> binary_splitting(IntegerDAGContext& context, uint64_t begin, uint64_t end, const SeriesGenerator& generator);
+
+//Products as balanced trees of products instead of chains, the operands of every level are of similar sizes.
+IntegerVarReference product(const std::vector<IntegerVarReference>& integers);
+IntegerVarReference product(IntegerDAGContext& context, uint64_t begin, uint64_t end);
+IntegerVarReference factorial(IntegerDAGContext& context, uint64_t n);
+IntegerVarReference binomial(IntegerDAGContext& context, uint64_t n, uint64_t k);
+
 }
 
 namespace pmp {
 
 using io = mpengine::IOBasic;
+using radix = mpengine::StoreRadix;
 using context = mpengine::IntegerDAGContext;
 using integer = mpengine::IntegerVarReference;
+using mpengine::sum;
+using mpengine::digit_shift_left;
+using mpengine::digit_shift_right;
+using mpengine::isqrt;
+using mpengine::powmod;
+using mpengine::gcd;
+using mpengine::gcdext;
+using mpengine::cmp;
+using mpengine::select;
+using series_term = mpengine::SeriesTerm;
+using mpengine::binary_splitting;
+using mpengine::product;
+using mpengine::factorial;
+using mpengine::binomial;
 
 }
@@ -2,14 +2,93 @@
 
 namespace mpengine {
 
+void check_binary_operands(const BasicNodeType* operand_A, const BasicNodeType* operand_B) {
+    if (operand_A->data == nullptr || operand_B->data == nullptr) {
+        throw PUTILS_GENERAL_EXCEPTION("Operands' datas are not initialized.", "DAG construction error");
+    }
+    if (operand_A->data->len != operand_B->data->len) {
+        std::stringstream ss;
+        ss << "Node data length mismatch: (" << operand_A->data->len << ") can not match (" << operand_B->data->len << ")!";
+        throw PUTILS_GENERAL_EXCEPTION(ss.str(), "DAG construction error");
+    }
+    if (operand_A->data->iobasic != operand_B->data->iobasic) {
+        std::stringstream ss;
+        ss << "Node data iobasic mismatch: (" << iofun::base_name(operand_A->data->iobasic) << ") can not match (" << iofun::base_name(operand_B->data->iobasic) << ")!";
+        throw PUTILS_GENERAL_EXCEPTION(ss.str(), "DAG construction error");
+    }
+    if (operand_A->data->radix != operand_B->data->radix) {
+        std::stringstream ss;
+        ss << "Node data radix mismatch: (" << iofun::radix_name(operand_A->data->radix) << ") can not match (" << iofun::radix_name(operand_B->data->radix) << ")!";
+        throw PUTILS_GENERAL_EXCEPTION(ss.str(), "DAG construction error");
+    }
+    return;
+}
+
+void finalize_product(
+    const BasicIntegerType::ElementType* product,
+    const size_t product_length,
+    const BasicNodeType::DataPtr& source_A,
+    const BasicNodeType::DataPtr& source_B,
+    const BasicNodeType::DataPtr& target_C
+) {
+    //Stores a product of product_length limbs into target_C, the limbs beyond its capacity must be zeros.
+    const size_t length = std::min<size_t>(product_length, target_C->len);
+    BasicIntegerType::ElementType* data_C = target_C->get_ensured_pointer();
+    memcpy(data_C, product, length * sizeof(BasicIntegerType::ElementType));
+    bool flag = false;
+    for (size_t i = length; i < product_length; i++) {
+        flag |= product[i] != 0ull;
+    }
+    target_C->used_len = u64_variable_length_integer_significant_length(data_C, length);
+    target_C->sign = (source_A->sign == source_B->sign) || target_C->used_len == 0;
+    if (flag) {
+        putils::RuntimeLog::get_global_log().add("(Runtime computations): Unexpected integer calculation overflow occurred!", putils::RuntimeLog::Level::WARN);
+    }
+    return;
+}
+
+bool measure_product_operands(
+    const BasicNodeType::DataPtr& source_A,
+    const BasicNodeType::DataPtr& source_B,
+    const BasicNodeType::DataPtr& target_C,
+    size_t& length
+) {
+    /* Sets length to the used limbs of the longer operand, the staged procedures split and transform only those.
+       A shorter operand within the schoolbook threshold (zero included) leaves nothing to split: the product is then
+       taken directly when it fits the capacity, and true is returned. */
+    static const size_t karatsuba_threshold = std::max<int64_t>(GlobalConfig::get_global_config().get_or_else<int64_t>(
+        "Configurations/core/Multiplication/karatsuba_threshold", 32ll
+    ), 1ll);
+    static const size_t ntt_threshold = std::max<int64_t>(GlobalConfig::get_global_config().get_or_else<int64_t>(
+        "Configurations/core/Multiplication/ntt_threshold", 4096ll
+    ), 1ll);
+    BasicIntegerType::ElementType* data_A = source_A->get_ensured_pointer();
+    BasicIntegerType::ElementType* data_B = source_B->get_ensured_pointer();
+    const size_t length_A = u64_variable_length_integer_significant_length(data_A, source_A->used_len);
+    const size_t length_B = u64_variable_length_integer_significant_length(data_B, source_B->used_len);
+    length = std::max<size_t>(length_A, length_B);
+    if (std::min<size_t>(length_A, length_B) > karatsuba_threshold || length_A + length_B > target_C->len) {
+        return false;
+    }
+    BasicIntegerType::ElementType* data_C = target_C->get_ensured_pointer();
+    dispatch_radix(*target_C, [&](auto base) {
+        u64_variable_length_integer_unbalanced_multiplication(data_A, data_B, data_C, length_A, length_B, base, karatsuba_threshold, ntt_threshold);
+    });
+    target_C->used_len = u64_variable_length_integer_significant_length(data_C, length_A + length_B);
+    target_C->sign = (source_A->sign == source_B->sign) || target_C->used_len == 0;
+    return true;
+}
+
 ArithmeticAddNodeForInteger::ArithmeticAddTaskForInteger::ArithmeticAddTaskForInteger(
     const DataHandle& source_A,
     const DataHandle& source_B,
     const DataHandle& target_C,
+    const bool subtract,
     const ComputeUnitPtr curr_unit
 ): source_A(source_A), 
    source_B(source_B), 
    target_C(target_C),
+   subtract(subtract),
    curr_unit(curr_unit) { 
     if (curr_unit == nullptr) {
         throw PUTILS_GENERAL_EXCEPTION("Unable to bind a task to compute unit pointer (nullptr)!", "DAG construction error");
@@ -20,39 +99,27 @@ void ArithmeticAddNodeForInteger::ArithmeticAddTaskForInteger::run() {
     BasicIntegerType::ElementType* data_A = source_A->get_ensured_pointer();
     BasicIntegerType::ElementType* data_B = source_B->get_ensured_pointer();
     BasicIntegerType::ElementType* data_C = target_C->get_ensured_pointer();
-    const size_t length = target_C->len;
-    const BasicIntegerType::ElementType base = iofun::store_base(target_C->iobasic);
+    //The sum fits one limb above the longer operand, the limbs beyond stay the zeros of the fresh block.
+    const size_t length = std::min<size_t>(target_C->len, std::max<size_t>(source_A->used_len, source_B->used_len) + 1);
+    const bool sign_A = source_A->sign, sign_B = source_B->sign != subtract;
     bool flag = false;
-    if (source_A->sign == source_B->sign) {
-        //For integers with the same sign, simply add their absolute values directly.
-        flag |= u64_variable_length_integer_addition_with_carry(data_A, data_B, data_C, length, base);
-        target_C->sign = source_A->sign;
-    } else {
-        int comp_result = u64_variable_length_integer_compare(data_A, data_B, length);
-        if (comp_result > 0) {
-            // |A| > |B| : |C| = |A| - |B|
-            flag |= u64_variable_length_integer_subtraction_with_carry_a_ge_b(data_A, data_B, data_C, length, base);
-            if (source_A->sign == 0 && source_B->sign == 1) {
-                // C = A + B = B - (-A) = |B| - |A| = -(|A| - |B|)
-                target_C->sign = 0;
-            } else if (source_A->sign == 1 && source_B->sign == 0) {
-                // C = A + B = A - (-B) = |A| - |B|
-                target_C->sign = 1;
-            }
-        } else if (comp_result < 0) {
-            // |A| < |B| : |C| = |B| - |A|
-            flag |= u64_variable_length_integer_subtraction_with_carry_a_ge_b(data_B, data_A, data_C, length, base);
-            if (source_A->sign == 0 && source_B->sign == 1) {
-                // C = A + B = B - (-A) = |B| - |A|
-                target_C->sign = 1;
-            } else if (source_A->sign == 1 && source_B->sign == 0) {
-                // C = A + B = A - (-B) = |A| - |B| = -(|B| - |A|)
-                target_C->sign = 0;
-            }
-        } else if (comp_result == 0) {
-            target_C->sign = 1;
+    dispatch_radix(*target_C, [&](auto base) {
+        if (sign_A == sign_B) {
+            //For integers with the same sign, simply add their absolute values directly.
+            flag |= u64_variable_length_integer_addition_with_carry(data_A, data_B, data_C, length, base);
+            target_C->sign = sign_A;
+            return;
         }
-    }
+        //|C| = |A| - |B| takes the sign of A, unless the borrow tells |A| < |B|, then |C| = |B| - |A| takes the sign of B.
+        const bool borrow = u64_variable_length_integer_subtraction_with_carry_a_ge_b(data_A, data_B, data_C, length, base);
+        if (borrow) {
+            u64_variable_length_integer_complement_in_place(data_C, length, base);
+            target_C->sign = sign_B;
+        } else {
+            target_C->sign = sign_A || std::all_of(data_C, data_C + length, [](BasicIntegerType::ElementType limb) { return limb == 0ull; });
+        }
+    });
+    target_C->used_len = u64_variable_length_integer_significant_length(data_C, length);
     if (flag) {
         putils::RuntimeLog::get_global_log().add("(Runtime computations): Unexpected integer calculation overflow occurred!", putils::RuntimeLog::Level::WARN);
     }
@@ -65,36 +132,210 @@ void ArithmeticAddNodeForInteger::ArithmeticAddTaskForInteger::run() {
 
 std::string ArithmeticAddNodeForInteger::ArithmeticAddTaskForInteger::description() const noexcept {
     std::stringstream ss;
-    ss << "task[" << reinterpret_cast<uintptr_t>(this) << "]:arithmetic_add_integer:";
+    ss << "task[" << reinterpret_cast<uintptr_t>(this) << "]:" << (subtract ? "arithmetic_sub_integer:" : "arithmetic_add_integer:");
     ss << "sources[" << source_A->get_status() << "," << source_B->get_status() << "],target[" << target_C->get_status() << "]";
     return ss.str();
 }
 
-ArithmeticAddNodeForInteger::ArithmeticAddNodeForInteger(NodeHandle& node_A, NodeHandle& node_B) {
+ArithmeticAddNodeForInteger::ArithmeticAddNodeForInteger(NodeHandle& node_A, NodeHandle& node_B, const bool subtract): subtract(subtract) {
     node_A->nexts.emplace_back(this);
     node_B->nexts.emplace_back(this);
     operand_A = node_A.get();
     operand_B = node_B.get();
-    if (operand_A->data == nullptr || operand_B->data == nullptr) {
-        throw PUTILS_GENERAL_EXCEPTION("Operands' datas are not initialized.", "DAG construction error");
+    try {
+        check_binary_operands(operand_A, operand_B);
+    } PUTILS_CATCH_THROW_GENERAL
+    data = std::make_shared<BasicIntegerType>(operand_A->data->log_len, operand_A->data->iobasic, operand_A->data->radix);
+}
+
+ArithmeticAddNodeForInteger::AdditionWorkspace::AdditionWorkspace(
+    const DataHandle& source_A,
+    const DataHandle& source_B,
+    const DataHandle& target_C,
+    const bool subtract,
+    size_t chunks
+): source_A(source_A),
+   source_B(source_B),
+   target_C(target_C),
+   subtract(subtract),
+   mode(Mode::add),
+   length(0),
+   bounds(chunks + 1, 0),
+   carries(chunks, 0),
+   propagates(chunks, 0) {}
+
+void ArithmeticAddNodeForInteger::AdditionWorkspace::prepare() {
+    //Every buffer is allocated here, so the chunk tasks only access allocated pointers.
+    source_A->get_ensured_pointer();
+    source_B->get_ensured_pointer();
+    target_C->get_ensured_pointer();
+    //Only the used limbs and the one a carry may reach are chunked, the limbs beyond stay the zeros of the fresh block.
+    length = std::min<size_t>(target_C->len, std::max<size_t>(source_A->used_len, source_B->used_len) + 1);
+    const size_t chunks = carries.size();
+    for (size_t i = 0; i <= chunks; i++) {
+        bounds[i] = length * i / chunks;
     }
-    if (operand_A->data->len != operand_B->data->len) {
-        std::stringstream ss;
-        ss << "Node data length mismatch: (" << operand_A->data->len << ") can not match (" << operand_B->data->len << ")!";
-        throw PUTILS_GENERAL_EXCEPTION(ss.str(), "DAG construction error");
+    //Opposite signs subtract |B| from |A| without comparing them, resolve() settles the sign by the final borrow.
+    mode = (source_A->sign == (source_B->sign != subtract)) ? Mode::add : Mode::subtract;
+    return;
+}
+
+void ArithmeticAddNodeForInteger::AdditionWorkspace::compute(size_t chunk_index) noexcept {
+    const size_t begin = bounds[chunk_index], length = bounds[chunk_index + 1] - begin;
+    if (length == 0) {
+        //An empty chunk (fewer used limbs than chunks) passes the incoming carry on.
+        carries[chunk_index] = 0;
+        propagates[chunk_index] = 1;
+        return;
     }
-    if (operand_A->data->iobasic != operand_B->data->iobasic) {
-        std::stringstream ss;
-        ss << "Node data iobasic mismatch: (" << iofun::base_name(operand_A->data->iobasic) << ") can not match (" << iofun::base_name(operand_B->data->iobasic) << ")!";
-        throw PUTILS_GENERAL_EXCEPTION(ss.str(), "DAG construction error");
+    BasicIntegerType::ElementType* data_A = source_A->get_pointer() + begin;
+    BasicIntegerType::ElementType* data_B = source_B->get_pointer() + begin;
+    BasicIntegerType::ElementType* data_C = target_C->get_pointer() + begin;
+    dispatch_radix(*target_C, [&](auto base) {
+        //An incoming carry ripples through limbs of base - 1 (the largest limb), an incoming borrow through zeros.
+        BasicIntegerType::ElementType ripple = 0ull;
+        switch (mode) {
+            case Mode::add: {
+                carries[chunk_index] = u64_variable_length_integer_addition_with_carry(data_A, data_B, data_C, length, base);
+                ripple = target_C->radix == StoreRadix::native ? ~0ull : iofun::store_base(target_C->iobasic, target_C->radix) - 1;
+                break;
+            }
+            case Mode::subtract: {
+                //The borrow out of the chunk is its carry, the difference wraps modulo base ^ length when it occurs.
+                carries[chunk_index] = u64_variable_length_integer_subtraction_with_carry_a_ge_b(data_A, data_B, data_C, length, base);
+                break;
+            }
+        }
+        propagates[chunk_index] = std::all_of(data_C, data_C + length, [ripple](BasicIntegerType::ElementType limb) { return limb == ripple; });
+    });
+    return;
+}
+
+void ArithmeticAddNodeForInteger::AdditionWorkspace::resolve() {
+    BasicIntegerType::ElementType* data_C = target_C->get_pointer();
+    BasicIntegerType::ElementType one = 1ull;
+    const bool sign_A = source_A->sign, sign_B = source_B->sign != subtract;
+    bool carry = false;
+    dispatch_radix(*target_C, [&](auto base) {
+        for (size_t i = 0; i + 1 < bounds.size(); i++) {
+            const size_t begin = bounds[i], length = bounds[i + 1] - begin;
+            if (carry && length != 0) {
+                //The correction stops at the first limb that does not ripple, unless the whole chunk propagates.
+                if (mode == Mode::add) {
+                    u64_variable_length_integer_addition_in_place(data_C + begin, &one, length, 1, base);
+                } else {
+                    u64_variable_length_integer_subtraction_in_place(data_C + begin, &one, length, 1, base);
+                }
+            }
+            carry = carries[i] || (carry && propagates[i]);
+        }
+        //A borrow out of the top chunk tells |A| < |B|, the wrapped difference is complemented into |B| - |A|.
+        if (mode == Mode::subtract && carry) {
+            u64_variable_length_integer_complement_in_place(data_C, length, base);
+        }
+    });
+    target_C->used_len = u64_variable_length_integer_significant_length(data_C, length);
+    if (mode == Mode::add) {
+        target_C->sign = sign_A;
+    } else {
+        target_C->sign = carry ? sign_B : (sign_A || target_C->used_len == 0);
+        carry = false;
+    }
+    if (carry) {
+        putils::RuntimeLog::get_global_log().add("(Runtime computations): Unexpected integer calculation overflow occurred!", putils::RuntimeLog::Level::WARN);
+    }
+    source_A.reset();
+    source_B.reset();
+    target_C.reset();
+    return;
+}
+
+ArithmeticAddNodeForInteger::AdditionStageTaskForInteger::AdditionStageTaskForInteger(
+    const AdditionWorkspaceHandle& workspace,
+    const Stage stage,
+    const size_t index,
+    const ComputeUnitPtr curr_unit
+): workspace(workspace), stage(stage), index(index), curr_unit(curr_unit) {
+    if (curr_unit == nullptr) {
+        throw PUTILS_GENERAL_EXCEPTION("Unable to bind a task to compute unit pointer (nullptr)!", "DAG construction error");
+    }
+}
+
+void ArithmeticAddNodeForInteger::AdditionStageTaskForInteger::run() {
+    try {
+        switch(stage) {
+            case Stage::prepare: workspace->prepare(); break;
+            case Stage::chunk: workspace->compute(index); break;
+            case Stage::resolve: workspace->resolve(); break;
+        }
+    } PUTILS_CATCH_THROW_GENERAL
+    workspace.reset();
+    curr_unit->forward();
+    return;
+}
+
+std::string ArithmeticAddNodeForInteger::AdditionStageTaskForInteger::description() const noexcept {
+    std::stringstream ss;
+    ss << "task[" << reinterpret_cast<uintptr_t>(this) << "]:";
+    switch(stage) {
+        case Stage::prepare: ss << "carry_select_prepare_integer:chunks[" << workspace->carries.size() << "]"; break;
+        case Stage::chunk: ss << "carry_select_chunk_integer:range[" << workspace->bounds[index] << "," << workspace->bounds[index + 1] << ")"; break;
+        case Stage::resolve: ss << "carry_select_resolve_integer:chunks[" << workspace->carries.size() << "]"; break;
     }
-    data = std::make_shared<BasicIntegerType>(operand_A->data->log_len, operand_A->data->iobasic);
+    return ss.str();
+}
+
+void ArithmeticAddNodeForInteger::generate_carry_select_procedure(size_t chunks) {
+    using Stage = AdditionStageTaskForInteger::Stage;
+    try {
+        auto workspace = std::make_shared<AdditionWorkspace>(operand_A->data, operand_B->data, data, subtract, chunks);
+        auto prepare_unit_ptr = std::make_unique<MonoUnit<MultiTaskSynchronizer>>();
+        prepare_unit_ptr->add_task(std::make_shared<AdditionStageTaskForInteger>(workspace, Stage::prepare, 0, prepare_unit_ptr.get()));
+        prepare_unit_ptr->add_dependency(operand_A->get_procedure_port());
+        prepare_unit_ptr->add_dependency(operand_B->get_procedure_port());
+        auto chunk_unit_ptr = std::make_unique<ParallelizableUnit<MonoSynchronizer>>();
+        for (size_t i = 0; i < chunks; i++) {
+            chunk_unit_ptr->add_task(std::make_shared<AdditionStageTaskForInteger>(workspace, Stage::chunk, i, chunk_unit_ptr.get()));
+        }
+        chunk_unit_ptr->add_dependency(*prepare_unit_ptr);
+        auto resolve_unit_ptr = std::make_unique<MonoUnit<MonoSynchronizer>>();
+        resolve_unit_ptr->add_task(std::make_shared<AdditionStageTaskForInteger>(workspace, Stage::resolve, 0, resolve_unit_ptr.get()));
+        resolve_unit_ptr->add_dependency(*chunk_unit_ptr);
+        procedure.emplace_back(std::move(prepare_unit_ptr));
+        procedure.emplace_back(std::move(chunk_unit_ptr));
+        procedure.emplace_back(std::move(resolve_unit_ptr));
+    } PUTILS_CATCH_THROW_GENERAL
+    return;
+}
+
+size_t ArithmeticAddNodeForInteger::carry_select_chunks() const {
+    static const size_t parallel_threshold = std::max<int64_t>(GlobalConfig::get_global_config().get_or_else<int64_t>(
+        "Configurations/core/Addition/parallel_threshold", 65536ll
+    ), 1ll);
+    static const size_t min_chunk_length = std::max<int64_t>(GlobalConfig::get_global_config().get_or_else<int64_t>(
+        "Configurations/core/Addition/min_chunk_length", 16384ll
+    ), 1ll);
+    //The sum is expected to take its bound (see estimate_bound()) rather than the capacity of the context.
+    const size_t length = std::min<size_t>(data->len, bound);
+    //One chunk per executor at most, so every chunk task can run on its own executor.
+    const size_t chunks = std::clamp<size_t>(length / min_chunk_length, 1, putils::ThreadPool::get_num_executors());
+    return length >= parallel_threshold ? chunks : 1;
+}
+
+void ArithmeticAddNodeForInteger::estimate_bound() noexcept {
+    bound = std::max<size_t>(operand_A->bound, operand_B->bound) + 1;
+    return;
 }
 
 void ArithmeticAddNodeForInteger::generate_procedure() {
+    const size_t chunks = carry_select_chunks();
+    if (chunks > 1) {
+        generate_carry_select_procedure(chunks);
+        return;
+    }
     try {
         auto compute_unit_ptr = std::make_unique<MonoUnit<MultiTaskSynchronizer>>();
-        compute_unit_ptr->add_task(std::make_shared<ArithmeticAddTaskForInteger>(operand_A->data, operand_B->data, data, compute_unit_ptr.get()));
+        compute_unit_ptr->add_task(std::make_shared<ArithmeticAddTaskForInteger>(operand_A->data, operand_B->data, data, subtract, compute_unit_ptr.get()));
         compute_unit_ptr->add_dependency(operand_A->get_procedure_port());
         compute_unit_ptr->add_dependency(operand_B->get_procedure_port());
         procedure.emplace_back(std::move(compute_unit_ptr));
@@ -102,4 +343,2408 @@ void ArithmeticAddNodeForInteger::generate_procedure() {
     return;
 }
 
+ArithmeticNegNodeForInteger::ArithmeticNegTaskForInteger::ArithmeticNegTaskForInteger(
+    const DataHandle& source,
+    const DataHandle& target,
+    const ComputeUnitPtr curr_unit
+): source(source), target(target), curr_unit(curr_unit) {
+    if (curr_unit == nullptr) {
+        throw PUTILS_GENERAL_EXCEPTION("Unable to bind a task to compute unit pointer (nullptr)!", "DAG construction error");
+    }
+}
+
+void ArithmeticNegNodeForInteger::ArithmeticNegTaskForInteger::run() {
+    try {
+        //Binds the limbs of the source, the lowest nonzero limb usually ends the zero test at once.
+        const BasicIntegerType::ElementType* data = target->get_ensured_pointer();
+        target->used_len = source->used_len;
+        const bool zero = std::all_of(data, data + target->used_len, [](BasicIntegerType::ElementType limb) { return limb == 0ull; });
+        target->sign = !source->sign || zero;
+    } PUTILS_CATCH_THROW_GENERAL
+    source.reset();
+    target.reset();
+    curr_unit->forward();
+    return;
+}
+
+std::string ArithmeticNegNodeForInteger::ArithmeticNegTaskForInteger::description() const noexcept {
+    std::stringstream ss;
+    ss << "task[" << reinterpret_cast<uintptr_t>(this) << "]:arithmetic_neg_integer:";
+    ss << "source[" << source->get_status() << "],target[" << target->get_status() << "]";
+    return ss.str();
+}
+
+ArithmeticNegNodeForInteger::ArithmeticNegNodeForInteger(NodeHandle& node) {
+    node->nexts.emplace_back(this);
+    operand = node.get();
+    if (operand->data == nullptr) {
+        throw PUTILS_GENERAL_EXCEPTION("Operand's data is not initialized.", "DAG construction error");
+    }
+    data = std::make_shared<BasicIntegerView>(operand->data);
+}
+
+void ArithmeticNegNodeForInteger::generate_procedure() {
+    try {
+        auto compute_unit_ptr = std::make_unique<MonoUnit<MultiTaskSynchronizer>>();
+        compute_unit_ptr->add_task(std::make_shared<ArithmeticNegTaskForInteger>(operand->data, data, compute_unit_ptr.get()));
+        compute_unit_ptr->add_dependency(operand->get_procedure_port());
+        procedure.emplace_back(std::move(compute_unit_ptr));
+    } PUTILS_CATCH_THROW_GENERAL
+    return;
+}
+
+ArithmeticSumNodeForInteger::SummationWorkspace::SummationWorkspace(
+    const std::vector<DataHandle>& sources,
+    const DataHandle& target,
+    size_t groups
+): sources(sources),
+   target(target),
+   bounds(groups + 1),
+   partials(groups, nullptr),
+   carries(groups, 0),
+   width(target->len) {
+    for (size_t i = 0; i <= groups; i++) {
+        bounds[i] = sources.size() * i / groups;
+    }
+}
+
+ArithmeticSumNodeForInteger::SummationWorkspace::~SummationWorkspace() {
+    for (auto& partial: partials) {
+        putils::release(partial);
+    }
+}
+
+void ArithmeticSumNodeForInteger::SummationWorkspace::prepare() {
+    //Every buffer is allocated here, so the gather tasks only access allocated pointers.
+    size_t used = 0;
+    for (auto& source: sources) {
+        source->get_ensured_pointer();
+        used = std::max<size_t>(used, source->used_len);
+    }
+    target->get_ensured_pointer();
+    //Fewer than UINT64_MAX / base operands carry at most two limbs above the longest one.
+    width = std::min<size_t>(target->len, used + 2);
+    return;
+}
+
+void ArithmeticSumNodeForInteger::SummationWorkspace::gather(size_t group_index) {
+    const size_t length = width;
+    try {
+        partials[group_index] = putils::MemoryPool::get_global_memorypool().allocate((length << 1) * sizeof(BasicIntegerType::ElementType));
+    } PUTILS_CATCH_THROW_GENERAL
+    ElementPtr positive = partials[group_index]->get<BasicIntegerType::ElementType>(), negative = positive + length;
+    std::fill(positive, positive + (length << 1), 0ull);
+    dispatch_radix(*target, [&](auto base) {
+        for (size_t i = bounds[group_index]; i < bounds[group_index + 1]; i++) {
+            ElementPtr data = sources[i]->get_pointer();
+            const size_t length_A = u64_variable_length_integer_significant_length(data, std::min<size_t>(sources[i]->used_len, length));
+            ElementPtr sum = sources[i]->sign ? positive : negative;
+            if constexpr (std::is_same_v<decltype(base), NativeRadix> || u64_is_wide_radix_v<decltype(base)>) {
+                carries[group_index] |= u64_variable_length_integer_addition_in_place(sum, data, length, length_A, base);
+            } else {
+                u64_variable_length_integer_raw_accumulation(sum, data, length_A);
+            }
+        }
+    });
+    return;
+}
+
+void ArithmeticSumNodeForInteger::SummationWorkspace::normalize() {
+    const size_t length = width;
+    ElementPtr positive = partials[0]->get<BasicIntegerType::ElementType>(), negative = positive + length;
+    ElementPtr data_C = target->get_pointer();
+    bool overflow = carries[0] != 0, sign = true;
+    dispatch_radix(*target, [&](auto base) {
+        constexpr bool carried = std::is_same_v<decltype(base), NativeRadix> || u64_is_wide_radix_v<decltype(base)>;
+        for (size_t j = 1; j < partials.size(); j++) {
+            ElementPtr partial_positive = partials[j]->get<BasicIntegerType::ElementType>(), partial_negative = partial_positive + length;
+            if constexpr (carried) {
+                overflow |= carries[j] != 0;
+                overflow |= u64_variable_length_integer_addition_in_place(positive, partial_positive, length, length, base);
+                overflow |= u64_variable_length_integer_addition_in_place(negative, partial_negative, length, length, base);
+            } else {
+                u64_variable_length_integer_raw_accumulation(positive, partial_positive, length);
+                u64_variable_length_integer_raw_accumulation(negative, partial_negative, length);
+            }
+            putils::release(partials[j]);
+        }
+        if constexpr (!carried) {
+            overflow |= u64_variable_length_integer_carry_normalization(positive, length, base) != 0ull;
+            overflow |= u64_variable_length_integer_carry_normalization(negative, length, base) != 0ull;
+        }
+        if (u64_variable_length_integer_compare(positive, negative, length) >= 0) {
+            u64_variable_length_integer_subtraction_with_carry_a_ge_b(positive, negative, data_C, length, base);
+        } else {
+            u64_variable_length_integer_subtraction_with_carry_a_ge_b(negative, positive, data_C, length, base);
+            sign = false;
+        }
+    });
+    target->used_len = u64_variable_length_integer_significant_length(data_C, length);
+    target->sign = sign;
+    putils::release(partials[0]);
+    if (overflow) {
+        putils::RuntimeLog::get_global_log().add("(Runtime computations): Unexpected integer calculation overflow occurred!", putils::RuntimeLog::Level::WARN);
+    }
+    sources.clear();
+    target.reset();
+    return;
+}
+
+ArithmeticSumNodeForInteger::SummationStageTaskForInteger::SummationStageTaskForInteger(
+    const SummationWorkspaceHandle& workspace,
+    const Stage stage,
+    const size_t index,
+    const ComputeUnitPtr curr_unit
+): workspace(workspace), stage(stage), index(index), curr_unit(curr_unit) {
+    if (curr_unit == nullptr) {
+        throw PUTILS_GENERAL_EXCEPTION("Unable to bind a task to compute unit pointer (nullptr)!", "DAG construction error");
+    }
+}
+
+void ArithmeticSumNodeForInteger::SummationStageTaskForInteger::run() {
+    try {
+        switch(stage) {
+            case Stage::prepare: workspace->prepare(); break;
+            case Stage::gather: workspace->gather(index); break;
+            case Stage::normalize: workspace->normalize(); break;
+            case Stage::serial:
+                workspace->prepare();
+                workspace->gather(0);
+                workspace->normalize();
+                break;
+        }
+    } PUTILS_CATCH_THROW_GENERAL
+    workspace.reset();
+    curr_unit->forward();
+    return;
+}
+
+std::string ArithmeticSumNodeForInteger::SummationStageTaskForInteger::description() const noexcept {
+    std::stringstream ss;
+    ss << "task[" << reinterpret_cast<uintptr_t>(this) << "]:";
+    switch(stage) {
+        case Stage::prepare: ss << "sum_prepare_integer:groups[" << workspace->partials.size() << "]"; break;
+        case Stage::gather: ss << "sum_gather_integer:operands[" << workspace->bounds[index] << "," << workspace->bounds[index + 1] << ")"; break;
+        case Stage::normalize: ss << "sum_normalize_integer:groups[" << workspace->partials.size() << "]"; break;
+        case Stage::serial: ss << "sum_serial_integer:operands[" << workspace->sources.size() << "]"; break;
+    }
+    return ss.str();
+}
+
+ArithmeticSumNodeForInteger::ArithmeticSumNodeForInteger(std::vector<NodeHandle>& nodes) {
+    if (nodes.empty()) {
+        throw PUTILS_GENERAL_EXCEPTION("Unable to sum an empty list of operands.", "DAG construction error");
+    }
+    for (auto& node: nodes) {
+        node->nexts.emplace_back(this);
+        operands.emplace_back(node.get());
+        try {
+            check_binary_operands(operands.front(), operands.back());
+        } PUTILS_CATCH_THROW_GENERAL
+    }
+    data = std::make_shared<BasicIntegerType>(operands.front()->data->log_len, operands.front()->data->iobasic, operands.front()->data->radix);
+}
+
+void ArithmeticSumNodeForInteger::replace_operand(NodePtr node, NodePtr replacement) noexcept {
+    std::replace(operands.begin(), operands.end(), node, replacement);
+    return;
+}
+
+void ArithmeticSumNodeForInteger::estimate_bound() noexcept {
+    //Fewer than base operands carry at most one limb above the longest one.
+    bound = 0;
+    for (auto operand: operands) {
+        bound = std::max<size_t>(bound, operand->bound);
+    }
+    bound += 1;
+    return;
+}
+
+void ArithmeticSumNodeForInteger::generate_procedure() {
+    using Stage = SummationStageTaskForInteger::Stage;
+    static const size_t parallel_threshold = std::max<int64_t>(GlobalConfig::get_global_config().get_or_else<int64_t>(
+        "Configurations/core/Summation/parallel_threshold", 65536ll
+    ), 1ll);
+    static const size_t min_chunk_length = std::max<int64_t>(GlobalConfig::get_global_config().get_or_else<int64_t>(
+        "Configurations/core/Summation/min_chunk_length", 16384ll
+    ), 1ll);
+    try {
+        //The raw limb sums of the compact radices hold UINT64_MAX / base operands.
+        if (data->radix == StoreRadix::compact && operands.size() > UINT64_MAX / iofun::store_base(data->iobasic)) {
+            throw PUTILS_GENERAL_EXCEPTION("Too many operands to sum without intermediate carries.", "DAG construction error");
+        }
+        //Every operand is expected to take its bound (see estimate_bound()) rather than the capacity of the context.
+        std::vector<DataHandle> sources;
+        size_t total = 0;
+        for (auto operand: operands) {
+            sources.emplace_back(operand->data);
+            total += std::min<size_t>(data->len, operand->bound);
+        }
+        const size_t groups = std::clamp<size_t>(total / min_chunk_length, 1, std::min<size_t>(putils::ThreadPool::get_num_executors(), operands.size()));
+        if (total < parallel_threshold || groups == 1) {
+            auto workspace = std::make_shared<SummationWorkspace>(sources, data, 1);
+            auto compute_unit_ptr = std::make_unique<MonoUnit<MultiTaskSynchronizer>>();
+            compute_unit_ptr->add_task(std::make_shared<SummationStageTaskForInteger>(workspace, Stage::serial, 0, compute_unit_ptr.get()));
+            for (auto operand: operands) {
+                compute_unit_ptr->add_dependency(operand->get_procedure_port());
+            }
+            procedure.emplace_back(std::move(compute_unit_ptr));
+            return;
+        }
+        auto workspace = std::make_shared<SummationWorkspace>(sources, data, groups);
+        auto prepare_unit_ptr = std::make_unique<MonoUnit<MultiTaskSynchronizer>>();
+        prepare_unit_ptr->add_task(std::make_shared<SummationStageTaskForInteger>(workspace, Stage::prepare, 0, prepare_unit_ptr.get()));
+        for (auto operand: operands) {
+            prepare_unit_ptr->add_dependency(operand->get_procedure_port());
+        }
+        auto gather_unit_ptr = std::make_unique<ParallelizableUnit<MonoSynchronizer>>();
+        for (size_t i = 0; i < groups; i++) {
+            gather_unit_ptr->add_task(std::make_shared<SummationStageTaskForInteger>(workspace, Stage::gather, i, gather_unit_ptr.get()));
+        }
+        gather_unit_ptr->add_dependency(*prepare_unit_ptr);
+        auto normalize_unit_ptr = std::make_unique<MonoUnit<MonoSynchronizer>>();
+        normalize_unit_ptr->add_task(std::make_shared<SummationStageTaskForInteger>(workspace, Stage::normalize, 0, normalize_unit_ptr.get()));
+        normalize_unit_ptr->add_dependency(*gather_unit_ptr);
+        procedure.emplace_back(std::move(prepare_unit_ptr));
+        procedure.emplace_back(std::move(gather_unit_ptr));
+        procedure.emplace_back(std::move(normalize_unit_ptr));
+    } PUTILS_CATCH_THROW_GENERAL
+    return;
+}
+
+ArithmeticScalarNodeForInteger::ArithmeticScalarTaskForInteger::ArithmeticScalarTaskForInteger(
+    const DataHandle& source,
+    const DataHandle& target,
+    const Operation operation,
+    const uint64_t scalar,
+    const ComputeUnitPtr curr_unit
+): source(source), target(target), operation(operation), scalar(scalar), curr_unit(curr_unit) {
+    if (curr_unit == nullptr) {
+        throw PUTILS_GENERAL_EXCEPTION("Unable to bind a task to compute unit pointer (nullptr)!", "DAG construction error");
+    }
+}
+
+void ArithmeticScalarNodeForInteger::ArithmeticScalarTaskForInteger::run() {
+    try {
+        BasicIntegerType::ElementType* data_A = source->get_ensured_pointer();
+        BasicIntegerType::ElementType* data_C = target->get_ensured_pointer();
+        //A word spans at most three limbs of the compact radices, the product never reaches beyond.
+        const size_t length = std::min<size_t>(target->len, source->used_len + 3);
+        bool flag = false;
+        if (scalar == 0ull && operation != Operation::multiply) {
+            std::fill(data_C, data_C + length, 0ull);
+            putils::RuntimeLog::get_global_log().add("(Runtime computations): Integer division by zero occurred!", putils::RuntimeLog::Level::WARN);
+        } else {
+            dispatch_radix(*target, [&](auto base) {
+                switch (operation) {
+                    case Operation::multiply: flag = u64_variable_length_integer_scalar_multiplication(data_A, data_C, length, scalar, base) != 0ull; break;
+                    case Operation::divide: u64_variable_length_integer_scalar_division(data_A, data_C, length, scalar, base); break;
+                    case Operation::modulo: {
+                        const uint64_t remainder = u64_variable_length_integer_scalar_modulo(data_A, length, scalar, base);
+                        u64_variable_length_integer_assign_word(data_C, length, remainder, base);
+                        break;
+                    }
+                }
+            });
+        }
+        target->used_len = u64_variable_length_integer_significant_length(data_C, length);
+        target->sign = source->sign || target->used_len == 0;
+        if (flag) {
+            putils::RuntimeLog::get_global_log().add("(Runtime computations): Unexpected integer calculation overflow occurred!", putils::RuntimeLog::Level::WARN);
+        }
+    } PUTILS_CATCH_THROW_GENERAL
+    source.reset();
+    target.reset();
+    curr_unit->forward();
+    return;
+}
+
+std::string ArithmeticScalarNodeForInteger::ArithmeticScalarTaskForInteger::description() const noexcept {
+    std::stringstream ss;
+    ss << "task[" << reinterpret_cast<uintptr_t>(this) << "]:";
+    switch (operation) {
+        case Operation::multiply: ss << "scalar_mul_integer:"; break;
+        case Operation::divide: ss << "scalar_div_integer:"; break;
+        case Operation::modulo: ss << "scalar_mod_integer:"; break;
+    }
+    ss << "scalar[" << scalar << "],source[" << source->get_status() << "],target[" << target->get_status() << "]";
+    return ss.str();
+}
+
+ArithmeticScalarNodeForInteger::ArithmeticScalarNodeForInteger(NodeHandle& node, const Operation operation, const uint64_t scalar): operation(operation), scalar(scalar) {
+    node->nexts.emplace_back(this);
+    operand = node.get();
+    if (operand->data == nullptr) {
+        throw PUTILS_GENERAL_EXCEPTION("Operand's data is not initialized.", "DAG construction error");
+    }
+    data = std::make_shared<BasicIntegerType>(operand->data->log_len, operand->data->iobasic, operand->data->radix);
+}
+
+void ArithmeticScalarNodeForInteger::estimate_bound() noexcept {
+    //A word spans at most three limbs of the compact radices.
+    bound = operation == Operation::multiply ? operand->bound + 3 : operand->bound;
+    return;
+}
+
+void ArithmeticScalarNodeForInteger::generate_procedure() {
+    try {
+        auto compute_unit_ptr = std::make_unique<MonoUnit<MultiTaskSynchronizer>>();
+        compute_unit_ptr->add_task(std::make_shared<ArithmeticScalarTaskForInteger>(operand->data, data, operation, scalar, compute_unit_ptr.get()));
+        compute_unit_ptr->add_dependency(operand->get_procedure_port());
+        procedure.emplace_back(std::move(compute_unit_ptr));
+    } PUTILS_CATCH_THROW_GENERAL
+    return;
+}
+
+ArithmeticShiftNodeForInteger::ShiftWorkspace::ShiftWorkspace(
+    const DataHandle& source,
+    const DataHandle& target,
+    const Direction direction,
+    const uint64_t unit,
+    const size_t count,
+    size_t chunks
+): source(source),
+   target(target),
+   direction(direction),
+   unit(unit),
+   count(count),
+   plan(),
+   overflow(false),
+   length(0),
+   bounds(chunks + 1, 0) {
+    plan = dispatch_radix(*target, [&](auto base) {
+        return u64_shift_plan(unit, count, base);
+    });
+}
+
+void ArithmeticShiftNodeForInteger::ShiftWorkspace::prepare() {
+    //Every buffer is allocated here, so the chunk tasks only access allocated pointers.
+    source->get_ensured_pointer();
+    target->get_ensured_pointer();
+    //A shift by base ^ limbs * m moves the used limbs by limbs, plus one for m. Only the output limbs they reach
+    //are chunked, the limbs beyond stay the zeros of the fresh block.
+    const size_t used = source->used_len;
+    length = direction == Direction::left ? std::min<size_t>(target->len, used + plan.limbs + 1) : used - std::min<size_t>(used, plan.limbs);
+    const size_t chunks = bounds.size() - 1;
+    for (size_t i = 0; i <= chunks; i++) {
+        bounds[i] = length * i / chunks;
+    }
+    return;
+}
+
+void ArithmeticShiftNodeForInteger::ShiftWorkspace::compute(size_t chunk_index) noexcept {
+    BasicIntegerType::ElementType* data_A = source->get_pointer();
+    BasicIntegerType::ElementType* data_C = target->get_pointer();
+    const size_t used = source->used_len, begin = bounds[chunk_index], end = bounds[chunk_index + 1];
+    dispatch_radix(*target, [&](auto base) {
+        if (direction == Direction::left) {
+            u64_variable_length_integer_shift_left(data_A, data_C, begin, end, plan.limbs, plan.factor, base);
+        } else {
+            u64_variable_length_integer_shift_right(data_A, data_C, used, begin, end, plan.limbs, plan.factor, base);
+        }
+    });
+    return;
+}
+
+void ArithmeticShiftNodeForInteger::ShiftWorkspace::finalize() {
+    BasicIntegerType::ElementType* data_C = target->get_pointer();
+    //The used limbs only reach past the capacity when they are moved up to its top limb.
+    if (plan.direct && direction == Direction::left && source->used_len + plan.limbs >= target->len) {
+        overflow = dispatch_radix(*target, [&](auto base) {
+            return u64_variable_length_integer_shift_left_overflow(source->get_pointer(), target->len, plan.limbs, plan.factor, base);
+        });
+    }
+    target->used_len = u64_variable_length_integer_significant_length(data_C, length);
+    target->sign = source->sign || target->used_len == 0;
+    if (overflow) {
+        putils::RuntimeLog::get_global_log().add("(Runtime computations): Unexpected integer calculation overflow occurred!", putils::RuntimeLog::Level::WARN);
+    }
+    source.reset();
+    target.reset();
+    return;
+}
+
+void ArithmeticShiftNodeForInteger::ShiftWorkspace::serial() {
+    prepare();
+    if (plan.direct) {
+        for (size_t i = 0; i + 1 < bounds.size(); i++) {
+            compute(i);
+        }
+    } else {
+        //The factor is applied by scalar passes of the largest power of the unit fitting in a word.
+        BasicIntegerType::ElementType* data_C = target->get_pointer();
+        length = source->used_len;
+        std::copy(source->get_pointer(), source->get_pointer() + length, data_C);
+        size_t exponent = 0;
+        const uint64_t step = u64_shift_step_factor(unit, exponent);
+        dispatch_radix(*target, [&](auto base) {
+            for (size_t rest = count; rest > 0; ) {
+                uint64_t factor = step;
+                if (rest < exponent) {
+                    factor = 1ull;
+                    for (size_t i = 0; i < rest; i++) {
+                        factor *= unit;
+                    }
+                }
+                if (direction == Direction::left) {
+                    //A word spans at most three limbs of the compact radices, every pass grows the used limbs by as many.
+                    length = std::min<size_t>(target->len, length + 3);
+                    overflow |= u64_variable_length_integer_scalar_multiplication(data_C, data_C, length, factor, base) != 0ull;
+                } else {
+                    u64_variable_length_integer_scalar_division(data_C, data_C, length, factor, base);
+                }
+                length = u64_variable_length_integer_significant_length(data_C, length);
+                rest -= std::min(rest, exponent);
+            }
+        });
+    }
+    finalize();
+    return;
+}
+
+ArithmeticShiftNodeForInteger::ShiftStageTaskForInteger::ShiftStageTaskForInteger(
+    const ShiftWorkspaceHandle& workspace,
+    const Stage stage,
+    const size_t index,
+    const ComputeUnitPtr curr_unit
+): workspace(workspace), stage(stage), index(index), curr_unit(curr_unit) {
+    if (curr_unit == nullptr) {
+        throw PUTILS_GENERAL_EXCEPTION("Unable to bind a task to compute unit pointer (nullptr)!", "DAG construction error");
+    }
+}
+
+void ArithmeticShiftNodeForInteger::ShiftStageTaskForInteger::run() {
+    try {
+        switch(stage) {
+            case Stage::prepare: workspace->prepare(); break;
+            case Stage::chunk: workspace->compute(index); break;
+            case Stage::finalize: workspace->finalize(); break;
+            case Stage::serial: workspace->serial(); break;
+        }
+    } PUTILS_CATCH_THROW_GENERAL
+    workspace.reset();
+    curr_unit->forward();
+    return;
+}
+
+std::string ArithmeticShiftNodeForInteger::ShiftStageTaskForInteger::description() const noexcept {
+    std::stringstream ss;
+    ss << "task[" << reinterpret_cast<uintptr_t>(this) << "]:";
+    switch(stage) {
+        case Stage::prepare: ss << "shift_prepare_integer:chunks[" << workspace->bounds.size() - 1 << "]"; break;
+        case Stage::chunk: ss << "shift_chunk_integer:range[" << workspace->bounds[index] << "," << workspace->bounds[index + 1] << ")"; break;
+        case Stage::finalize: ss << "shift_finalize_integer:limbs[" << workspace->plan.limbs << "],factor[" << workspace->plan.factor << "]"; break;
+        case Stage::serial: ss << "shift_serial_integer:unit[" << workspace->unit << "],count[" << workspace->count << "]"; break;
+    }
+    return ss.str();
+}
+
+ArithmeticShiftNodeForInteger::ArithmeticShiftNodeForInteger(NodeHandle& node, const Direction direction, const Unit unit, const size_t count):
+direction(direction), unit(unit), count(count) {
+    node->nexts.emplace_back(this);
+    operand = node.get();
+    if (operand->data == nullptr) {
+        throw PUTILS_GENERAL_EXCEPTION("Operand's data is not initialized.", "DAG construction error");
+    }
+    data = std::make_shared<BasicIntegerType>(operand->data->log_len, operand->data->iobasic, operand->data->radix);
+}
+
+void ArithmeticShiftNodeForInteger::estimate_bound() noexcept {
+    bound = operand->bound;
+    if (direction == Direction::left) {
+        //A limb holds at least floor(log2(base)) bits, or log_store_base digits.
+        const size_t per_limb = unit == Unit::bit
+            ? (data->radix == StoreRadix::native ? 64 : std::bit_width(iofun::store_base(data->iobasic, data->radix)) - 1)
+            : iofun::log_store_base(data->iobasic, data->radix);
+        bound += count / per_limb + 1;
+    }
+    return;
+}
+
+void ArithmeticShiftNodeForInteger::generate_procedure() {
+    using Stage = ShiftStageTaskForInteger::Stage;
+    static const size_t parallel_threshold = std::max<int64_t>(GlobalConfig::get_global_config().get_or_else<int64_t>(
+        "Configurations/core/Shift/parallel_threshold", 65536ll
+    ), 1ll);
+    static const size_t min_chunk_length = std::max<int64_t>(GlobalConfig::get_global_config().get_or_else<int64_t>(
+        "Configurations/core/Shift/min_chunk_length", 16384ll
+    ), 1ll);
+    try {
+        //The result is expected to take its bound (see estimate_bound()) rather than the capacity of the context.
+        const size_t length = std::min<size_t>(data->len, bound);
+        const size_t chunks = std::clamp<size_t>(length / min_chunk_length, 1, putils::ThreadPool::get_num_executors());
+        const uint64_t unit_base = unit == Unit::bit ? 2ull : iofun::io_base(data->iobasic);
+        auto workspace = std::make_shared<ShiftWorkspace>(operand->data, data, direction, unit_base, count, chunks);
+        if (!workspace->plan.direct || length < parallel_threshold || chunks == 1) {
+            auto compute_unit_ptr = std::make_unique<MonoUnit<MultiTaskSynchronizer>>();
+            compute_unit_ptr->add_task(std::make_shared<ShiftStageTaskForInteger>(workspace, Stage::serial, 0, compute_unit_ptr.get()));
+            compute_unit_ptr->add_dependency(operand->get_procedure_port());
+            procedure.emplace_back(std::move(compute_unit_ptr));
+            return;
+        }
+        auto prepare_unit_ptr = std::make_unique<MonoUnit<MultiTaskSynchronizer>>();
+        prepare_unit_ptr->add_task(std::make_shared<ShiftStageTaskForInteger>(workspace, Stage::prepare, 0, prepare_unit_ptr.get()));
+        prepare_unit_ptr->add_dependency(operand->get_procedure_port());
+        auto chunk_unit_ptr = std::make_unique<ParallelizableUnit<MonoSynchronizer>>();
+        for (size_t i = 0; i < chunks; i++) {
+            chunk_unit_ptr->add_task(std::make_shared<ShiftStageTaskForInteger>(workspace, Stage::chunk, i, chunk_unit_ptr.get()));
+        }
+        chunk_unit_ptr->add_dependency(*prepare_unit_ptr);
+        auto finalize_unit_ptr = std::make_unique<MonoUnit<MonoSynchronizer>>();
+        finalize_unit_ptr->add_task(std::make_shared<ShiftStageTaskForInteger>(workspace, Stage::finalize, 0, finalize_unit_ptr.get()));
+        finalize_unit_ptr->add_dependency(*chunk_unit_ptr);
+        procedure.emplace_back(std::move(prepare_unit_ptr));
+        procedure.emplace_back(std::move(chunk_unit_ptr));
+        procedure.emplace_back(std::move(finalize_unit_ptr));
+    } PUTILS_CATCH_THROW_GENERAL
+    return;
+}
+
+ArithmeticMulNodeForInteger::KaratsubaWorkspace::KaratsubaWorkspace(
+    const DataHandle& source_A,
+    const DataHandle& source_B,
+    const DataHandle& target_C,
+    size_t length,
+    size_t threshold,
+    size_t depth,
+    bool square
+): source_A(source_A),
+   source_B(source_B),
+   target_C(target_C),
+   block(nullptr),
+   frames(),
+   leaves(),
+   total_length(0),
+   threshold(threshold),
+   depth(depth),
+   planned_leaves(0),
+   direct(false),
+   square(square) {
+    //The root product holds (length << 1) limbs, the limbs beyond the capacity are only used for overflow detection.
+    total_length = length << 1;
+    plan(length, depth);
+    planned_leaves = leaves.size();
+}
+
+ArithmeticMulNodeForInteger::KaratsubaWorkspace::~KaratsubaWorkspace() {
+    putils::release(block);
+}
+
+size_t ArithmeticMulNodeForInteger::KaratsubaWorkspace::plan(size_t length, size_t depth) {
+    const size_t index = frames.size();
+    frames.emplace_back();
+    frames[index].length = length;
+    frames[index].half = (length + 1) >> 1;
+    frames[index].leaf = depth == 0 || length <= threshold;
+    frames[index].carry_A = frames[index].carry_B = false;
+    frames[index].operand_A = frames[index].operand_B = frames[index].product = nullptr;
+    if (frames[index].leaf) {
+        leaves.emplace_back(index);
+        frames[index].scratch_offset = total_length;
+        total_length += u64_karatsuba_scratch_length(length, threshold);
+        return index;
+    }
+    const size_t half = frames[index].half;
+    frames[index].sums_offset = total_length;
+    total_length += half << 1;
+    frames[index].middle_offset = total_length;
+    total_length += (half << 1) + 1;
+    const size_t low = plan(half, depth - 1);
+    const size_t middle = plan(half, depth - 1);
+    const size_t high = plan(length - half, depth - 1);
+    frames[index].children[0] = low;
+    frames[index].children[1] = middle;
+    frames[index].children[2] = high;
+    return index;
+}
+
+void ArithmeticMulNodeForInteger::KaratsubaWorkspace::split() {
+    try {
+        size_t length = 0;
+        direct = measure_product_operands(source_A, source_B, target_C, length);
+        if (direct) {
+            return;
+        }
+        //The frames are planned again for the used limbs, the depth of the generated procedure is kept.
+        frames.clear();
+        leaves.clear();
+        total_length = length << 1;
+        plan(length, depth);
+        block = putils::MemoryPool::get_global_memorypool().allocate(total_length * sizeof(BasicIntegerType::ElementType));
+    } PUTILS_CATCH_THROW_GENERAL
+    ElementPtr base_ptr = block->get<BasicIntegerType::ElementType>();
+    frames[0].operand_A = source_A->get_ensured_pointer();
+    frames[0].operand_B = source_B->get_ensured_pointer();
+    frames[0].product = base_ptr;
+    for (auto& frame: frames) {
+        if (frame.leaf) {
+            continue;
+        }
+        const size_t half = frame.half, rest = frame.length - half;
+        ElementPtr sums = base_ptr + frame.sums_offset;
+        dispatch_radix(*target_C, [&](auto base) {
+            frame.carry_A = u64_variable_length_integer_addition_unbalanced(frame.operand_A, frame.operand_A + half, sums, half, rest, base);
+            if (square) {
+                frame.carry_B = frame.carry_A;
+            } else {
+                frame.carry_B = u64_variable_length_integer_addition_unbalanced(frame.operand_B, frame.operand_B + half, sums + half, half, rest, base);
+            }
+        });
+        KaratsubaFrame& low = frames[frame.children[0]];
+        KaratsubaFrame& middle = frames[frame.children[1]];
+        KaratsubaFrame& high = frames[frame.children[2]];
+        low.operand_A = frame.operand_A;
+        low.operand_B = frame.operand_B;
+        low.product = frame.product;
+        middle.operand_A = sums;
+        middle.operand_B = square ? sums : sums + half;
+        middle.product = base_ptr + frame.middle_offset;
+        high.operand_A = frame.operand_A + half;
+        high.operand_B = frame.operand_B + half;
+        high.product = frame.product + (half << 1);
+    }
+    return;
+}
+
+void ArithmeticMulNodeForInteger::KaratsubaWorkspace::multiply(size_t leaf_index) noexcept {
+    if (direct || leaf_index >= leaves.size()) {
+        return;
+    }
+    KaratsubaFrame& frame = frames[leaves[leaf_index]];
+    ElementPtr scratch = block->get<BasicIntegerType::ElementType>() + frame.scratch_offset;
+    dispatch_radix(*target_C, [&](auto base) {
+        if (square) {
+            u64_variable_length_integer_karatsuba_squaring(frame.operand_A, frame.product, frame.length, base, scratch, threshold);
+        } else {
+            u64_variable_length_integer_karatsuba_multiplication(frame.operand_A, frame.operand_B, frame.product, frame.length, base, scratch, threshold);
+        }
+    });
+    return;
+}
+
+void ArithmeticMulNodeForInteger::KaratsubaWorkspace::merge() {
+    if (!direct) {
+        dispatch_radix(*target_C, [&](auto base) {
+            for (auto it = frames.rbegin(); it != frames.rend(); it++) {
+                if (it->leaf) {
+                    continue;
+                }
+                const KaratsubaFrame& middle = frames[it->children[1]];
+                u64_karatsuba_merge(
+                    it->product, middle.product, middle.operand_A, middle.operand_B,
+                    it->carry_A, it->carry_B, it->half, it->length, base
+                );
+            }
+        });
+        try {
+            finalize_product(frames[0].product, frames[0].length << 1, source_A, source_B, target_C);
+        } PUTILS_CATCH_THROW_GENERAL
+    }
+    putils::release(block);
+    source_A.reset();
+    source_B.reset();
+    target_C.reset();
+    return;
+}
+
+ArithmeticMulNodeForInteger::KaratsubaSplitTaskForInteger::KaratsubaSplitTaskForInteger(
+    const WorkspaceHandle& workspace,
+    const ComputeUnitPtr curr_unit
+): workspace(workspace), curr_unit(curr_unit) {
+    if (curr_unit == nullptr) {
+        throw PUTILS_GENERAL_EXCEPTION("Unable to bind a task to compute unit pointer (nullptr)!", "DAG construction error");
+    }
+}
+
+void ArithmeticMulNodeForInteger::KaratsubaSplitTaskForInteger::run() {
+    try {
+        workspace->split();
+    } PUTILS_CATCH_THROW_GENERAL
+    workspace.reset();
+    curr_unit->forward();
+    return;
+}
+
+std::string ArithmeticMulNodeForInteger::KaratsubaSplitTaskForInteger::description() const noexcept {
+    std::stringstream ss;
+    ss << "task[" << reinterpret_cast<uintptr_t>(this) << "]:karatsuba_split_integer:";
+    ss << "frames[" << workspace->frames.size() << "],workspace_length[" << workspace->total_length << "]";
+    return ss.str();
+}
+
+ArithmeticMulNodeForInteger::KaratsubaLeafTaskForInteger::KaratsubaLeafTaskForInteger(
+    const WorkspaceHandle& workspace,
+    const size_t leaf_index,
+    const ComputeUnitPtr curr_unit
+): workspace(workspace), leaf_index(leaf_index), curr_unit(curr_unit) {
+    if (curr_unit == nullptr) {
+        throw PUTILS_GENERAL_EXCEPTION("Unable to bind a task to compute unit pointer (nullptr)!", "DAG construction error");
+    }
+}
+
+void ArithmeticMulNodeForInteger::KaratsubaLeafTaskForInteger::run() {
+    workspace->multiply(leaf_index);
+    workspace.reset();
+    curr_unit->forward();
+    return;
+}
+
+std::string ArithmeticMulNodeForInteger::KaratsubaLeafTaskForInteger::description() const noexcept {
+    std::stringstream ss;
+    ss << "task[" << reinterpret_cast<uintptr_t>(this) << "]:karatsuba_leaf_integer:";
+    ss << "leaf[" << leaf_index << "],leaves[" << workspace->leaves.size() << "]";
+    return ss.str();
+}
+
+ArithmeticMulNodeForInteger::KaratsubaMergeTaskForInteger::KaratsubaMergeTaskForInteger(
+    const WorkspaceHandle& workspace,
+    const ComputeUnitPtr curr_unit,
+    const bool serial
+): workspace(workspace), curr_unit(curr_unit), serial(serial) {
+    if (curr_unit == nullptr) {
+        throw PUTILS_GENERAL_EXCEPTION("Unable to bind a task to compute unit pointer (nullptr)!", "DAG construction error");
+    }
+}
+
+void ArithmeticMulNodeForInteger::KaratsubaMergeTaskForInteger::run() {
+    try {
+        //Operands below the parallel threshold are multiplied by a single task. Otherwise only the leaves that
+        //outgrew the generated leaf tasks (used limbs beyond the bounds) are multiplied here.
+        if (serial) {
+            workspace->split();
+        }
+        for (size_t i = serial ? 0 : workspace->planned_leaves; i < workspace->leaves.size(); i++) {
+            workspace->multiply(i);
+        }
+        workspace->merge();
+    } PUTILS_CATCH_THROW_GENERAL
+    workspace.reset();
+    curr_unit->forward();
+    return;
+}
+
+std::string ArithmeticMulNodeForInteger::KaratsubaMergeTaskForInteger::description() const noexcept {
+    std::stringstream ss;
+    ss << "task[" << reinterpret_cast<uintptr_t>(this) << "]:" << (serial ? "karatsuba_serial_integer:" : "karatsuba_merge_integer:");
+    ss << "sources[" << workspace->source_A->get_status() << "," << workspace->source_B->get_status() << "],target[" << workspace->target_C->get_status() << "]";
+    return ss.str();
+}
+
+ArithmeticMulNodeForInteger::ArithmeticMulNodeForInteger(NodeHandle& node_A, NodeHandle& node_B) {
+    node_A->nexts.emplace_back(this);
+    node_B->nexts.emplace_back(this);
+    operand_A = node_A.get();
+    operand_B = node_B.get();
+    square = operand_A == operand_B;
+    try {
+        check_binary_operands(operand_A, operand_B);
+    } PUTILS_CATCH_THROW_GENERAL
+    data = std::make_shared<BasicIntegerType>(operand_A->data->log_len, operand_A->data->iobasic, operand_A->data->radix);
+}
+
+ArithmeticMulNodeForInteger::NTTWorkspace::NTTWorkspace(
+    const DataHandle& source_A,
+    const DataHandle& source_B,
+    const DataHandle& target_C,
+    size_t length,
+    bool square
+): source_A(source_A),
+   source_B(source_B),
+   target_C(target_C),
+   blocks(),
+   pieces(target_C->radix == StoreRadix::compact ? 1 : 2),
+   length(length),
+   transform_length(std::bit_ceil((length << 1) * pieces)),
+   direct(false),
+   square(square) {}
+
+ArithmeticMulNodeForInteger::NTTWorkspace::~NTTWorkspace() {
+    for (auto& operand_blocks: blocks) {
+        for (auto& block: operand_blocks) {
+            putils::release(block);
+        }
+    }
+}
+
+uint32_t* ArithmeticMulNodeForInteger::NTTWorkspace::get_transform(size_t operand_index, size_t prime_index) const noexcept {
+    return blocks[operand_index][prime_index]->get<uint32_t>();
+}
+
+void ArithmeticMulNodeForInteger::NTTWorkspace::prepare() {
+    try {
+        direct = measure_product_operands(source_A, source_B, target_C, length);
+    } PUTILS_CATCH_THROW_GENERAL
+    transform_length = std::bit_ceil((length << 1) * pieces);
+    return;
+}
+
+void ArithmeticMulNodeForInteger::NTTWorkspace::forward(size_t operand_index, size_t prime_index) {
+    const DataHandle& source = operand_index == 0 ? source_A : source_B;
+    if (direct) {
+        return;
+    }
+    try {
+        blocks[operand_index][prime_index] = putils::MemoryPool::get_global_memorypool().allocate(transform_length * sizeof(uint32_t));
+        uint32_t* transform = get_transform(operand_index, prime_index);
+        dispatch_radix(*target_C, [&](auto base) {
+            if constexpr (u64_ntt_pieces_v<decltype(base)> == 2) {
+                u32_ntt_load(source->get_ensured_pointer(), transform, length, transform_length, prime_index, base);
+            } else {
+                u32_ntt_load(source->get_ensured_pointer(), transform, length, transform_length, prime_index);
+            }
+        });
+        u32_number_theoretic_transform(transform, transform_length, prime_index, false);
+    } PUTILS_CATCH_THROW_GENERAL
+    return;
+}
+
+void ArithmeticMulNodeForInteger::NTTWorkspace::pointwise(size_t prime_index, size_t chunk_index, size_t chunks) noexcept {
+    if (direct) {
+        return;
+    }
+    const size_t begin = transform_length * chunk_index / chunks, end = transform_length * (chunk_index + 1) / chunks;
+    uint32_t* transform = get_transform(0, prime_index) + begin;
+    u32_pointwise_multiplication(transform, square ? transform : get_transform(1, prime_index) + begin, end - begin, prime_index);
+    return;
+}
+
+void ArithmeticMulNodeForInteger::NTTWorkspace::inverse(size_t prime_index) {
+    putils::release(blocks[1][prime_index]);
+    if (direct) {
+        return;
+    }
+    try {
+        u32_number_theoretic_transform(get_transform(0, prime_index), transform_length, prime_index, true);
+    } PUTILS_CATCH_THROW_GENERAL
+    return;
+}
+
+void ArithmeticMulNodeForInteger::NTTWorkspace::recombine() {
+    if (!direct) {
+        const size_t length_C = std::min<size_t>(length << 1, target_C->len);
+        const uint32_t *r0 = get_transform(0, 0), *r1 = get_transform(0, 1), *r2 = get_transform(0, 2);
+        ElementPtr data_C = target_C->get_ensured_pointer();
+        const bool flag = dispatch_radix(*target_C, [&](auto base) {
+            return u32_ntt_recombine(r0, r1, r2, transform_length, data_C, length_C, base);
+        });
+        target_C->used_len = u64_variable_length_integer_significant_length(data_C, length_C);
+        target_C->sign = (source_A->sign == source_B->sign) || target_C->used_len == 0;
+        if (flag) {
+            putils::RuntimeLog::get_global_log().add("(Runtime computations): Unexpected integer calculation overflow occurred!", putils::RuntimeLog::Level::WARN);
+        }
+    }
+    for (auto& block: blocks[0]) {
+        putils::release(block);
+    }
+    source_A.reset();
+    source_B.reset();
+    target_C.reset();
+    return;
+}
+
+ArithmeticMulNodeForInteger::NTTStageTaskForInteger::NTTStageTaskForInteger(
+    const NTTWorkspaceHandle& workspace,
+    const Stage stage,
+    const size_t prime_index,
+    const size_t begin,
+    const size_t end,
+    const ComputeUnitPtr curr_unit
+): workspace(workspace), stage(stage), prime_index(prime_index), begin(begin), end(end), curr_unit(curr_unit) {
+    if (curr_unit == nullptr) {
+        throw PUTILS_GENERAL_EXCEPTION("Unable to bind a task to compute unit pointer (nullptr)!", "DAG construction error");
+    }
+}
+
+void ArithmeticMulNodeForInteger::NTTStageTaskForInteger::run() {
+    try {
+        switch(stage) {
+            case Stage::prepare: workspace->prepare(); break;
+            case Stage::forward: workspace->forward(begin, prime_index); break;
+            case Stage::pointwise: workspace->pointwise(prime_index, begin, end); break;
+            case Stage::inverse: workspace->inverse(prime_index); break;
+            case Stage::recombine: workspace->recombine(); break;
+        }
+    } PUTILS_CATCH_THROW_GENERAL
+    workspace.reset();
+    curr_unit->forward();
+    return;
+}
+
+std::string ArithmeticMulNodeForInteger::NTTStageTaskForInteger::description() const noexcept {
+    std::stringstream ss;
+    ss << "task[" << reinterpret_cast<uintptr_t>(this) << "]:";
+    switch(stage) {
+        case Stage::prepare: ss << "ntt_prepare_integer:length[" << workspace->transform_length << "]"; break;
+        case Stage::forward: ss << "ntt_forward_integer:operand[" << begin << "],prime[" << prime_index << "]"; break;
+        case Stage::pointwise: ss << "ntt_pointwise_integer:prime[" << prime_index << "],chunk[" << begin << "/" << end << "]"; break;
+        case Stage::inverse: ss << "ntt_inverse_integer:prime[" << prime_index << "]"; break;
+        case Stage::recombine: ss << "ntt_recombine_integer:length[" << workspace->transform_length << "]"; break;
+    }
+    return ss.str();
+}
+
+ArithmeticMulNodeForInteger::ToomCookWorkspace::ToomCookWorkspace(
+    const DataHandle& source_A,
+    const DataHandle& source_B,
+    const DataHandle& target_C,
+    const ToomCookScheme& scheme,
+    size_t length,
+    size_t threshold,
+    bool square
+): source_A(source_A),
+   source_B(source_B),
+   target_C(target_C),
+   block(nullptr),
+   scheme(scheme),
+   threshold(threshold),
+   signs_A(),
+   signs_B(),
+   signs(),
+   direct(false),
+   square(square) {
+    fit(length);
+}
+
+void ArithmeticMulNodeForInteger::ToomCookWorkspace::fit(size_t length) noexcept {
+    //Sizes the parts, the pointwise products and their scratch for operands of length limbs.
+    this->length = length;
+    part_length = u64_toom_cook_part_length(length, scheme);
+    width = part_length + 1;
+    product_length = width << 1;
+    scratch_length = std::max<size_t>(u64_karatsuba_scratch_length(width, threshold), product_length + 1);
+    return;
+}
+
+ArithmeticMulNodeForInteger::ToomCookWorkspace::~ToomCookWorkspace() {
+    putils::release(block);
+}
+
+ArithmeticMulNodeForInteger::ElementPtr ArithmeticMulNodeForInteger::ToomCookWorkspace::get_values(size_t operand_index) const noexcept {
+    return block->get<BasicIntegerType::ElementType>() + operand_index * scheme.points * width;
+}
+
+ArithmeticMulNodeForInteger::ElementPtr ArithmeticMulNodeForInteger::ToomCookWorkspace::get_products() const noexcept {
+    return get_values(2);
+}
+
+ArithmeticMulNodeForInteger::ElementPtr ArithmeticMulNodeForInteger::ToomCookWorkspace::get_coefficients() const noexcept {
+    return get_products() + scheme.points * product_length;
+}
+
+ArithmeticMulNodeForInteger::ElementPtr ArithmeticMulNodeForInteger::ToomCookWorkspace::get_scratch(size_t index) const noexcept {
+    return get_coefficients() + scheme.points * (product_length + 1) + index * scratch_length;
+}
+
+ArithmeticMulNodeForInteger::ElementPtr ArithmeticMulNodeForInteger::ToomCookWorkspace::get_result() const noexcept {
+    return get_scratch(scheme.points);
+}
+
+void ArithmeticMulNodeForInteger::ToomCookWorkspace::evaluate() {
+    try {
+        direct = measure_product_operands(source_A, source_B, target_C, length);
+        if (direct) {
+            return;
+        }
+        fit(length);
+        const size_t total_length = ((scheme.points * width) << 1) + scheme.points * (product_length * 2 + 1) + scheme.points * scratch_length + (length << 1);
+        block = putils::MemoryPool::get_global_memorypool().allocate(total_length * sizeof(BasicIntegerType::ElementType));
+    } PUTILS_CATCH_THROW_GENERAL
+    ElementPtr data_A = source_A->get_ensured_pointer(), data_B = source_B->get_ensured_pointer();
+    dispatch_radix(*target_C, [&](auto base) {
+        u64_toom_cook_evaluate(data_A, length, scheme, get_values(0), signs_A, get_scratch(0), base);
+        if (!square) {
+            u64_toom_cook_evaluate(data_B, length, scheme, get_values(1), signs_B, get_scratch(0), base);
+        }
+    });
+    for (size_t i = 0; i < scheme.points; i++) {
+        signs[i] = square || signs_A[i] == signs_B[i];
+    }
+    return;
+}
+
+void ArithmeticMulNodeForInteger::ToomCookWorkspace::multiply(size_t point_index) noexcept {
+    if (direct) {
+        return;
+    }
+    ElementPtr values = get_values(0) + point_index * width, product = get_products() + point_index * product_length;
+    dispatch_radix(*target_C, [&](auto base) {
+        if (square) {
+            u64_variable_length_integer_karatsuba_squaring(values, product, width, base, get_scratch(point_index), threshold);
+        } else {
+            u64_variable_length_integer_karatsuba_multiplication(
+                values, get_values(1) + point_index * width, product, width,
+                base, get_scratch(point_index), threshold
+            );
+        }
+    });
+    return;
+}
+
+void ArithmeticMulNodeForInteger::ToomCookWorkspace::interpolate(size_t coefficient_index) noexcept {
+    if (direct) {
+        return;
+    }
+    dispatch_radix(*target_C, [&](auto base) {
+        u64_toom_cook_interpolate(
+            get_products(), signs, product_length, scheme, coefficient_index,
+            get_coefficients() + coefficient_index * (product_length + 1), get_scratch(coefficient_index), base
+        );
+    });
+    return;
+}
+
+void ArithmeticMulNodeForInteger::ToomCookWorkspace::compose() {
+    if (!direct) {
+        const size_t length_C = length << 1;
+        ElementPtr result = get_result();
+        std::fill(result, result + length_C, 0ull);
+        dispatch_radix(*target_C, [&](auto base) {
+            for (size_t j = 0; j < scheme.points; j++) {
+                u64_toom_cook_compose(result, get_coefficients() + j * (product_length + 1), length_C, product_length, j * part_length, base);
+            }
+        });
+        try {
+            finalize_product(result, length_C, source_A, source_B, target_C);
+        } PUTILS_CATCH_THROW_GENERAL
+    }
+    putils::release(block);
+    source_A.reset();
+    source_B.reset();
+    target_C.reset();
+    return;
+}
+
+ArithmeticMulNodeForInteger::ToomCookStageTaskForInteger::ToomCookStageTaskForInteger(
+    const ToomCookWorkspaceHandle& workspace,
+    const Stage stage,
+    const size_t index,
+    const ComputeUnitPtr curr_unit
+): workspace(workspace), stage(stage), index(index), curr_unit(curr_unit) {
+    if (curr_unit == nullptr) {
+        throw PUTILS_GENERAL_EXCEPTION("Unable to bind a task to compute unit pointer (nullptr)!", "DAG construction error");
+    }
+}
+
+void ArithmeticMulNodeForInteger::ToomCookStageTaskForInteger::run() {
+    try {
+        switch(stage) {
+            case Stage::evaluate: workspace->evaluate(); break;
+            case Stage::multiply: workspace->multiply(index); break;
+            case Stage::interpolate: workspace->interpolate(index); break;
+            case Stage::compose: workspace->compose(); break;
+        }
+    } PUTILS_CATCH_THROW_GENERAL
+    workspace.reset();
+    curr_unit->forward();
+    return;
+}
+
+std::string ArithmeticMulNodeForInteger::ToomCookStageTaskForInteger::description() const noexcept {
+    std::stringstream ss;
+    ss << "task[" << reinterpret_cast<uintptr_t>(this) << "]:";
+    switch(stage) {
+        case Stage::evaluate: ss << "toom" << workspace->scheme.way << "_evaluate_integer:part_length[" << workspace->part_length << "]"; break;
+        case Stage::multiply: ss << "toom" << workspace->scheme.way << "_multiply_integer:point[" << index << "]"; break;
+        case Stage::interpolate: ss << "toom" << workspace->scheme.way << "_interpolate_integer:coefficient[" << index << "]"; break;
+        case Stage::compose: ss << "toom" << workspace->scheme.way << "_compose_integer:points[" << workspace->scheme.points << "]"; break;
+    }
+    return ss.str();
+}
+
+void ArithmeticMulNodeForInteger::generate_karatsuba_procedure(size_t length) {
+    static const size_t karatsuba_threshold = std::max<int64_t>(GlobalConfig::get_global_config().get_or_else<int64_t>(
+        "Configurations/core/Multiplication/karatsuba_threshold", 32ll
+    ), 1ll);
+    static const size_t parallel_threshold = std::max<int64_t>(GlobalConfig::get_global_config().get_or_else<int64_t>(
+        "Configurations/core/Multiplication/parallel_threshold", 512ll
+    ), 1ll);
+    static const size_t max_parallel_depth = std::max<int64_t>(GlobalConfig::get_global_config().get_or_else<int64_t>(
+        "Configurations/core/Multiplication/max_parallel_depth", 2ll
+    ), 0ll);
+    try {
+        //Each unrolled level triples the number of independent leaf products.
+        size_t depth = 0;
+        while (depth < max_parallel_depth && (length >> depth) >= parallel_threshold && (length >> depth) > karatsuba_threshold) {
+            depth++;
+        }
+        auto workspace = std::make_shared<KaratsubaWorkspace>(operand_A->data, operand_B->data, data, length, karatsuba_threshold, depth, square);
+        if (depth == 0) {
+            auto compute_unit_ptr = std::make_unique<MonoUnit<MultiTaskSynchronizer>>();
+            compute_unit_ptr->add_task(std::make_shared<KaratsubaMergeTaskForInteger>(workspace, compute_unit_ptr.get(), true));
+            compute_unit_ptr->add_dependency(operand_A->get_procedure_port());
+            compute_unit_ptr->add_dependency(operand_B->get_procedure_port());
+            procedure.emplace_back(std::move(compute_unit_ptr));
+            return;
+        }
+        auto split_unit_ptr = std::make_unique<MonoUnit<MultiTaskSynchronizer>>();
+        split_unit_ptr->add_task(std::make_shared<KaratsubaSplitTaskForInteger>(workspace, split_unit_ptr.get()));
+        split_unit_ptr->add_dependency(operand_A->get_procedure_port());
+        split_unit_ptr->add_dependency(operand_B->get_procedure_port());
+        auto leaf_unit_ptr = std::make_unique<ParallelizableUnit<MonoSynchronizer>>();
+        for (size_t i = 0; i < workspace->leaves.size(); i++) {
+            leaf_unit_ptr->add_task(std::make_shared<KaratsubaLeafTaskForInteger>(workspace, i, leaf_unit_ptr.get()));
+        }
+        leaf_unit_ptr->add_dependency(*split_unit_ptr);
+        auto merge_unit_ptr = std::make_unique<MonoUnit<MonoSynchronizer>>();
+        merge_unit_ptr->add_task(std::make_shared<KaratsubaMergeTaskForInteger>(workspace, merge_unit_ptr.get()));
+        merge_unit_ptr->add_dependency(*leaf_unit_ptr);
+        procedure.emplace_back(std::move(split_unit_ptr));
+        procedure.emplace_back(std::move(leaf_unit_ptr));
+        procedure.emplace_back(std::move(merge_unit_ptr));
+    } PUTILS_CATCH_THROW_GENERAL
+    return;
+}
+
+void ArithmeticMulNodeForInteger::generate_toom_cook_procedure(const ToomCookScheme& scheme, size_t length) {
+    using Stage = ToomCookStageTaskForInteger::Stage;
+    static const size_t karatsuba_threshold = std::max<int64_t>(GlobalConfig::get_global_config().get_or_else<int64_t>(
+        "Configurations/core/Multiplication/karatsuba_threshold", 32ll
+    ), 1ll);
+    try {
+        auto workspace = std::make_shared<ToomCookWorkspace>(operand_A->data, operand_B->data, data, scheme, length, karatsuba_threshold, square);
+        auto evaluate_unit_ptr = std::make_unique<MonoUnit<MultiTaskSynchronizer>>();
+        evaluate_unit_ptr->add_task(std::make_shared<ToomCookStageTaskForInteger>(workspace, Stage::evaluate, 0, evaluate_unit_ptr.get()));
+        evaluate_unit_ptr->add_dependency(operand_A->get_procedure_port());
+        evaluate_unit_ptr->add_dependency(operand_B->get_procedure_port());
+        auto multiply_unit_ptr = std::make_unique<ParallelizableUnit<MonoSynchronizer>>();
+        auto interpolate_unit_ptr = std::make_unique<ParallelizableUnit<MonoSynchronizer>>();
+        for (size_t i = 0; i < scheme.points; i++) {
+            multiply_unit_ptr->add_task(std::make_shared<ToomCookStageTaskForInteger>(workspace, Stage::multiply, i, multiply_unit_ptr.get()));
+            interpolate_unit_ptr->add_task(std::make_shared<ToomCookStageTaskForInteger>(workspace, Stage::interpolate, i, interpolate_unit_ptr.get()));
+        }
+        multiply_unit_ptr->add_dependency(*evaluate_unit_ptr);
+        interpolate_unit_ptr->add_dependency(*multiply_unit_ptr);
+        auto compose_unit_ptr = std::make_unique<MonoUnit<MonoSynchronizer>>();
+        compose_unit_ptr->add_task(std::make_shared<ToomCookStageTaskForInteger>(workspace, Stage::compose, 0, compose_unit_ptr.get()));
+        compose_unit_ptr->add_dependency(*interpolate_unit_ptr);
+        procedure.emplace_back(std::move(evaluate_unit_ptr));
+        procedure.emplace_back(std::move(multiply_unit_ptr));
+        procedure.emplace_back(std::move(interpolate_unit_ptr));
+        procedure.emplace_back(std::move(compose_unit_ptr));
+    } PUTILS_CATCH_THROW_GENERAL
+    return;
+}
+
+void ArithmeticMulNodeForInteger::generate_ntt_procedure(size_t length) {
+    using Stage = NTTStageTaskForInteger::Stage;
+    try {
+        auto workspace = std::make_shared<NTTWorkspace>(operand_A->data, operand_B->data, data, length, square);
+        const size_t transform_length = workspace->transform_length;
+        const size_t chunks = std::clamp<size_t>(transform_length >> 16, 1, 16);
+        auto prepare_unit_ptr = std::make_unique<MonoUnit<MultiTaskSynchronizer>>();
+        prepare_unit_ptr->add_task(std::make_shared<NTTStageTaskForInteger>(workspace, Stage::prepare, 0, 0, 0, prepare_unit_ptr.get()));
+        prepare_unit_ptr->add_dependency(operand_A->get_procedure_port());
+        prepare_unit_ptr->add_dependency(operand_B->get_procedure_port());
+        auto forward_unit_ptr = std::make_unique<ParallelizableUnit<MonoSynchronizer>>();
+        for (size_t k = 0; k < ntt_prime_count; k++) {
+            forward_unit_ptr->add_task(std::make_shared<NTTStageTaskForInteger>(workspace, Stage::forward, k, 0, 0, forward_unit_ptr.get()));
+            if (!square) {
+                forward_unit_ptr->add_task(std::make_shared<NTTStageTaskForInteger>(workspace, Stage::forward, k, 1, 0, forward_unit_ptr.get()));
+            }
+        }
+        forward_unit_ptr->add_dependency(*prepare_unit_ptr);
+        auto pointwise_unit_ptr = std::make_unique<ParallelizableUnit<MonoSynchronizer>>();
+        for (size_t k = 0; k < ntt_prime_count; k++) {
+            for (size_t i = 0; i < chunks; i++) {
+                pointwise_unit_ptr->add_task(std::make_shared<NTTStageTaskForInteger>(workspace, Stage::pointwise, k, i, chunks, pointwise_unit_ptr.get()));
+            }
+        }
+        pointwise_unit_ptr->add_dependency(*forward_unit_ptr);
+        auto inverse_unit_ptr = std::make_unique<ParallelizableUnit<MonoSynchronizer>>();
+        for (size_t k = 0; k < ntt_prime_count; k++) {
+            inverse_unit_ptr->add_task(std::make_shared<NTTStageTaskForInteger>(workspace, Stage::inverse, k, 0, 0, inverse_unit_ptr.get()));
+        }
+        inverse_unit_ptr->add_dependency(*pointwise_unit_ptr);
+        auto recombine_unit_ptr = std::make_unique<MonoUnit<MonoSynchronizer>>();
+        recombine_unit_ptr->add_task(std::make_shared<NTTStageTaskForInteger>(workspace, Stage::recombine, 0, 0, 0, recombine_unit_ptr.get()));
+        recombine_unit_ptr->add_dependency(*inverse_unit_ptr);
+        procedure.emplace_back(std::move(prepare_unit_ptr));
+        procedure.emplace_back(std::move(forward_unit_ptr));
+        procedure.emplace_back(std::move(pointwise_unit_ptr));
+        procedure.emplace_back(std::move(inverse_unit_ptr));
+        procedure.emplace_back(std::move(recombine_unit_ptr));
+    } PUTILS_CATCH_THROW_GENERAL
+    return;
+}
+
+void ArithmeticMulNodeForInteger::estimate_bound() noexcept {
+    bound = operand_A->bound + operand_B->bound;
+    return;
+}
+
+void ArithmeticMulNodeForInteger::generate_procedure() {
+    static const size_t toom3_threshold = std::max<int64_t>(GlobalConfig::get_global_config().get_or_else<int64_t>(
+        "Configurations/core/Multiplication/toom3_threshold", 1024ll
+    ), 1ll);
+    static const size_t toom4_threshold = std::max<int64_t>(GlobalConfig::get_global_config().get_or_else<int64_t>(
+        "Configurations/core/Multiplication/toom4_threshold", 2048ll
+    ), 1ll);
+    static const size_t ntt_threshold = std::max<int64_t>(GlobalConfig::get_global_config().get_or_else<int64_t>(
+        "Configurations/core/Multiplication/ntt_threshold", 4096ll
+    ), 1ll);
+    try {
+        //The tier and the size of its stages follow the operand length expected from the bounds (see estimate_bound()),
+        //the procedures fit themselves to the used limbs again once the operands are ready.
+        const size_t length = std::clamp<size_t>(std::max<size_t>(operand_A->bound, operand_B->bound), 1, data->len);
+        //The transform length (length << 1, doubled for the pieces of native and wide limbs) is bounded by the 2-adic order of the NTT primes.
+        const size_t transform_length = std::bit_ceil((data->len << 1) * (data->radix == StoreRadix::compact ? 1 : 2));
+        if (length >= ntt_threshold && transform_length <= (1ull << ntt_max_log_length)) {
+            generate_ntt_procedure(length);
+        } else if (length >= toom4_threshold) {
+            generate_toom_cook_procedure(toom4_scheme, length);
+        } else if (length >= toom3_threshold) {
+            generate_toom_cook_procedure(toom3_scheme, length);
+        } else {
+            generate_karatsuba_procedure(length);
+        }
+    } PUTILS_CATCH_THROW_GENERAL
+    return;
+}
+
+ArithmeticMulAddNodeForInteger::ArithmeticMulAddNodeForInteger(ArithmeticAddNodeForInteger& node_add, ArithmeticMulNodeForInteger& node_mul):
+negate_product(node_add.subtract && node_add.operand_B == &node_mul),
+negate_accumulator(node_add.subtract && node_add.operand_A == &node_mul) {
+    if (node_mul.nexts.size() != 1 || node_mul.nexts.front() != &node_add) {
+        throw PUTILS_GENERAL_EXCEPTION("Unable to fuse a product consumed by other nodes.", "DAG construction error");
+    }
+    operand_A = node_mul.operand_A;
+    operand_B = node_mul.operand_B;
+    operand_C = node_add.operand_A == &node_mul ? node_add.operand_B : node_add.operand_A;
+    std::replace(operand_A->nexts.begin(), operand_A->nexts.end(), static_cast<NodePtr>(&node_mul), static_cast<NodePtr>(this));
+    std::replace(operand_B->nexts.begin(), operand_B->nexts.end(), static_cast<NodePtr>(&node_mul), static_cast<NodePtr>(this));
+    std::replace(operand_C->nexts.begin(), operand_C->nexts.end(), static_cast<NodePtr>(&node_add), static_cast<NodePtr>(this));
+    //The consumers keep reading the data of the addition node.
+    data = node_add.data;
+    nexts = std::move(node_add.nexts);
+    for (auto next_node_ptr: nexts) {
+        next_node_ptr->replace_operand(&node_add, this);
+    }
+    node_add.nexts.clear();
+    node_mul.nexts.clear();
+}
+
+ArithmeticMulAddNodeForInteger::ArithmeticMulAddTaskForInteger::ArithmeticMulAddTaskForInteger(
+    const DataHandle& source_A,
+    const DataHandle& source_B,
+    const DataHandle& source_C,
+    const DataHandle& target_D,
+    const bool negate_product,
+    const bool negate_accumulator,
+    size_t karatsuba_threshold,
+    size_t ntt_threshold,
+    const ComputeUnitPtr curr_unit
+): source_A(source_A),
+   source_B(source_B),
+   source_C(source_C),
+   target_D(target_D),
+   negate_product(negate_product),
+   negate_accumulator(negate_accumulator),
+   karatsuba_threshold(karatsuba_threshold),
+   ntt_threshold(ntt_threshold),
+   curr_unit(curr_unit) {
+    if (curr_unit == nullptr) {
+        throw PUTILS_GENERAL_EXCEPTION("Unable to bind a task to compute unit pointer (nullptr)!", "DAG construction error");
+    }
+}
+
+void ArithmeticMulAddNodeForInteger::ArithmeticMulAddTaskForInteger::run() {
+    try {
+        ElementPtr data_A = source_A->get_ensured_pointer();
+        ElementPtr data_B = source_B->get_ensured_pointer();
+        ElementPtr data_C = source_C->get_ensured_pointer();
+        ElementPtr data_D = target_D->get_ensured_pointer();
+        const size_t length_A = u64_variable_length_integer_significant_length(data_A, source_A->used_len);
+        const size_t length_B = u64_variable_length_integer_significant_length(data_B, source_B->used_len);
+        const size_t length_C = u64_variable_length_integer_significant_length(data_C, source_C->used_len);
+        //The result fits one limb above the longer of the product and the accumulator, the limbs beyond stay zeros.
+        const size_t length = std::min<size_t>(target_D->len, std::max<size_t>(length_A + length_B, length_C) + 1);
+        const bool sign_P = (source_A->sign == source_B->sign) != negate_product;
+        const bool sign_C = source_C->sign != negate_accumulator;
+        const bool mixed = sign_P != sign_C && length_C != 0;
+        bool truncated = false, overflow = false, sign = length_C != 0 ? sign_C : sign_P;
+        std::copy(data_C, data_C + length, data_D);
+        dispatch_radix(*target_D, [&](auto base) {
+            if (mixed) {
+                u64_variable_length_integer_complement_in_place(data_D, length, base);
+            }
+            const uint64_t wraps = u64_variable_length_integer_multiply_accumulate(
+                data_A, data_B, data_D, length_A, length_B, length, base, karatsuba_threshold, ntt_threshold, truncated
+            );
+            if (!mixed) {
+                overflow = wraps != 0ull;
+            } else if (wraps == 0ull) {
+                u64_variable_length_integer_complement_in_place(data_D, length, base);
+            } else {
+                sign = sign_P;
+                overflow = wraps > 1ull;
+            }
+        });
+        target_D->used_len = u64_variable_length_integer_significant_length(data_D, length);
+        target_D->sign = sign || target_D->used_len == 0;
+        if (overflow || truncated) {
+            putils::RuntimeLog::get_global_log().add("(Runtime computations): Unexpected integer calculation overflow occurred!", putils::RuntimeLog::Level::WARN);
+        }
+    } PUTILS_CATCH_THROW_GENERAL
+    source_A.reset();
+    source_B.reset();
+    source_C.reset();
+    target_D.reset();
+    curr_unit->forward();
+    return;
+}
+
+std::string ArithmeticMulAddNodeForInteger::ArithmeticMulAddTaskForInteger::description() const noexcept {
+    std::stringstream ss;
+    ss << "task[" << reinterpret_cast<uintptr_t>(this) << "]:arithmetic_muladd_integer:";
+    ss << "product[" << (negate_product ? "-" : "+") << "],accumulator[" << (negate_accumulator ? "-" : "+") << "],len[" << target_D->len << "]";
+    return ss.str();
+}
+
+void ArithmeticMulAddNodeForInteger::estimate_bound() noexcept {
+    bound = std::max<size_t>(operand_A->bound + operand_B->bound, operand_C->bound) + 1;
+    return;
+}
+
+void ArithmeticMulAddNodeForInteger::generate_procedure() {
+    static const size_t karatsuba_threshold = std::max<int64_t>(GlobalConfig::get_global_config().get_or_else<int64_t>(
+        "Configurations/core/Multiplication/karatsuba_threshold", 32ll
+    ), 1ll);
+    static const size_t ntt_threshold = std::max<int64_t>(GlobalConfig::get_global_config().get_or_else<int64_t>(
+        "Configurations/core/Multiplication/ntt_threshold", 4096ll
+    ), 1ll);
+    try {
+        auto compute_unit_ptr = std::make_unique<MonoUnit<MultiTaskSynchronizer>>();
+        compute_unit_ptr->add_task(std::make_shared<ArithmeticMulAddTaskForInteger>(
+            operand_A->data, operand_B->data, operand_C->data, data, negate_product, negate_accumulator,
+            karatsuba_threshold, ntt_threshold, compute_unit_ptr.get()
+        ));
+        compute_unit_ptr->add_dependency(operand_A->get_procedure_port());
+        compute_unit_ptr->add_dependency(operand_B->get_procedure_port());
+        compute_unit_ptr->add_dependency(operand_C->get_procedure_port());
+        procedure.emplace_back(std::move(compute_unit_ptr));
+    } PUTILS_CATCH_THROW_GENERAL
+    return;
+}
+
+ArithmeticDivNodeForInteger::ArithmeticDivNodeForInteger(NodeHandle& node_A, NodeHandle& node_B, const Output output): output(output) {
+    node_A->nexts.emplace_back(this);
+    node_B->nexts.emplace_back(this);
+    operand_A = node_A.get();
+    operand_B = node_B.get();
+    try {
+        check_binary_operands(operand_A, operand_B);
+    } PUTILS_CATCH_THROW_GENERAL
+    data = std::make_shared<BasicIntegerType>(operand_A->data->log_len, operand_A->data->iobasic, operand_A->data->radix);
+}
+
+ArithmeticDivNodeForInteger::DivisionWorkspace::DivisionWorkspace(
+    const DataHandle& source_A,
+    const DataHandle& source_B,
+    const DataHandle& target_C,
+    const Output output,
+    size_t chunks,
+    size_t threshold,
+    size_t karatsuba_threshold,
+    size_t ntt_threshold
+): source_A(source_A),
+   source_B(source_B),
+   target_C(target_C),
+   block(nullptr),
+   output(output),
+   mode(Mode::zero),
+   chunks(chunks),
+   threshold(threshold),
+   karatsuba_threshold(karatsuba_threshold),
+   ntt_threshold(ntt_threshold),
+   length_A(0), length_B(0), length_Q(0), length_R(0), length_V(0), length_T(0),
+   precision(0), padding(0), factor(1),
+   max_steps(0),
+   first_slot(0),
+   ladder(),
+   negative(false),
+   product_X(nullptr), product_Y(nullptr),
+   product_length_X(0), product_length_Y(0),
+   partials(chunks, nullptr) {
+    //The longest divisor needs the longest precision ladder, shorter ones skip the leading iterations.
+    max_steps = u64_newton_precision_ladder(target_C->len + 1, threshold).size() - 1;
+}
+
+ArithmeticDivNodeForInteger::DivisionWorkspace::~DivisionWorkspace() {
+    for (auto& partial: partials) {
+        putils::release(partial);
+    }
+    putils::release(block);
+}
+
+ArithmeticDivNodeForInteger::ElementPtr ArithmeticDivNodeForInteger::DivisionWorkspace::get_buffer(size_t index) const noexcept {
+    /* Buffers: 0 normalized dividend, 1 normalized divisor, 2 reciprocal, 3 next reciprocal, 4 residual,
+       5 gathered product, 6 quotient, 7 schoolbook scratch. The residual and the product are twice as long. */
+    const size_t width = target_C->len + 4;
+    return block->get<BasicIntegerType::ElementType>() + width * index + (index > 4 ? width : 0) + (index > 5 ? width : 0);
+}
+
+bool ArithmeticDivNodeForInteger::DivisionWorkspace::active(size_t slot) const noexcept {
+    return mode == Mode::newton && slot >= first_slot;
+}
+
+void ArithmeticDivNodeForInteger::DivisionWorkspace::schedule(const ElementPtr X, size_t length_X, const ElementPtr Y, size_t length_Y) noexcept {
+    //Plans the product consumed by the next combine step, the product is written into buffer 5.
+    product_X = X;
+    product_Y = Y;
+    product_length_X = length_X;
+    product_length_Y = length_Y;
+    return;
+}
+
+void ArithmeticDivNodeForInteger::DivisionWorkspace::schedule_iteration(size_t slot) noexcept {
+    //Every iteration starts with the product D_H * V_h of its residual.
+    const size_t H = ladder[slot - first_slot + 1];
+    schedule(get_buffer(1) + padding + length_B - H, H, get_buffer(2), length_V);
+    return;
+}
+
+void ArithmeticDivNodeForInteger::DivisionWorkspace::gather() {
+    //Sums the partial products at the offsets of their chunks of Y.
+    const size_t length = product_length_X + product_length_Y;
+    ElementPtr product = get_buffer(5);
+    std::fill(product, product + length, 0ull);
+    dispatch_radix(*target_C, [&](auto base) {
+        for (size_t j = 0; j < chunks; j++) {
+            if (partials[j] == nullptr) {
+                continue;
+            }
+            const size_t begin = product_length_Y * j / chunks, end = product_length_Y * (j + 1) / chunks;
+            u64_variable_length_integer_addition_in_place(
+                product + begin, partials[j]->get<BasicIntegerType::ElementType>(), length - begin, product_length_X + end - begin, base
+            );
+            putils::release(partials[j]);
+        }
+    });
+    return;
+}
+
+void ArithmeticDivNodeForInteger::DivisionWorkspace::prepare() {
+    //Every buffer is allocated here, so the later stages only access allocated pointers.
+    source_A->get_ensured_pointer();
+    source_B->get_ensured_pointer();
+    target_C->get_ensured_pointer();
+    try {
+        block = putils::MemoryPool::get_global_memorypool().allocate(((target_C->len + 4) * 10) * sizeof(BasicIntegerType::ElementType));
+    } PUTILS_CATCH_THROW_GENERAL
+    dispatch_radix(*target_C, [&](auto base) {
+        prepare(base);
+    });
+    return;
+}
+
+template<typename Radix>
+void ArithmeticDivNodeForInteger::DivisionWorkspace::prepare(const Radix base) {
+    const size_t length = target_C->len;
+    ElementPtr data_A = source_A->get_pointer(), data_B = source_B->get_pointer();
+    ElementPtr dividend = get_buffer(0), divisor = get_buffer(1), reciprocal = get_buffer(2);
+    ElementPtr residual = get_buffer(4), quotient = get_buffer(6), scratch = get_buffer(7);
+    length_A = u64_variable_length_integer_significant_length(data_A, std::min<size_t>(source_A->used_len, length));
+    length_B = u64_variable_length_integer_significant_length(data_B, std::min<size_t>(source_B->used_len, length));
+    length_Q = length_R = 0;
+    if (length_B == 0) {
+        mode = Mode::zero;
+        putils::RuntimeLog::get_global_log().add("(Runtime computations): Integer division by zero occurred!", putils::RuntimeLog::Level::WARN);
+        return;
+    }
+    if (u64_variable_length_integer_compare_unbalanced(data_A, length_A, data_B, length_B) < 0) {
+        //|A| < |B|: Q = 0, R = A.
+        mode = Mode::trivial;
+        std::copy(data_A, data_A + length_A, residual);
+        length_R = length_A;
+        return;
+    }
+    if (length_B == 1) {
+        mode = Mode::small;
+        std::copy(data_A, data_A + length_A, quotient);
+        residual[0] = u64_variable_length_integer_division_by_small(quotient, length_A, data_B[0], base);
+        length_Q = length_A;
+        length_R = 1;
+        return;
+    }
+    //Normalization: the leading limb of the divisor is at least half of the base.
+    factor = u64_normalization_factor(data_B[length_B - 1], base);
+    const size_t length_U = length_A + 1, k = length_U - length_B;
+    std::fill(dividend, dividend + length_U, 0ull);
+    u64_variable_length_integer_multiply_add_small(dividend, data_A, length_U, length_A, factor, base);
+    if (std::min(k, length_B) < threshold) {
+        mode = Mode::schoolbook;
+        std::fill(divisor, divisor + length_B, 0ull);
+        u64_variable_length_integer_multiply_add_small(divisor, data_B, length_B, length_B, factor, base);
+        u64_variable_length_integer_schoolbook_division(dividend, length_U, divisor, length_B, quotient, scratch, base);
+        std::copy(dividend, dividend + length_B, residual);
+        u64_variable_length_integer_division_by_small(residual, length_B, factor, base);
+        length_Q = k;
+        length_R = length_B;
+        return;
+    }
+    //The reciprocal carries k + 2 limbs, the divisor is padded with zeros when it is shorter.
+    mode = Mode::newton;
+    precision = k + 2;
+    padding = precision > length_B ? precision - length_B : 0;
+    std::fill(divisor, divisor + padding + length_B, 0ull);
+    u64_variable_length_integer_multiply_add_small(divisor + padding, data_B, length_B, length_B, factor, base);
+    ladder = u64_newton_precision_ladder(precision, threshold);
+    first_slot = max_steps - (ladder.size() - 1);
+    //The initial reciprocal floor(base ^ 2h / D_h) is computed by the schoolbook division.
+    const size_t h = ladder.front();
+    std::fill(residual, residual + (h << 1) + 1, 0ull);
+    residual[h << 1] = 1ull;
+    u64_variable_length_integer_schoolbook_division(residual, (h << 1) + 1, divisor + padding + length_B - h, h, reciprocal, scratch, base);
+    length_V = h + 1;
+    if (ladder.size() > 1) {
+        schedule_iteration(first_slot);
+    } else {
+        schedule(dividend + length_B - 2, k + 2, reciprocal, length_V);
+    }
+    return;
+}
+
+void ArithmeticDivNodeForInteger::DivisionWorkspace::multiply(size_t slot, size_t chunk_index) {
+    //Multiplies X by the chunk of Y into a partial product of its own.
+    if (!active(slot)) {
+        return;
+    }
+    const size_t begin = product_length_Y * chunk_index / chunks, end = product_length_Y * (chunk_index + 1) / chunks;
+    if (begin == end || product_length_X == 0) {
+        return;
+    }
+    try {
+        partials[chunk_index] = putils::MemoryPool::get_global_memorypool().allocate((product_length_X + end - begin) * sizeof(BasicIntegerType::ElementType));
+    } PUTILS_CATCH_THROW_GENERAL
+    dispatch_radix(*target_C, [&](auto base) {
+        u64_variable_length_integer_unbalanced_multiplication(
+            product_X, product_Y + begin, partials[chunk_index]->get<BasicIntegerType::ElementType>(),
+            product_length_X, end - begin, base, karatsuba_threshold, ntt_threshold
+        );
+    });
+    return;
+}
+
+void ArithmeticDivNodeForInteger::DivisionWorkspace::combine(size_t slot, Step step) {
+    if (!active(slot)) {
+        return;
+    }
+    gather();
+    dispatch_radix(*target_C, [&](auto base) {
+        combine(slot, step, base);
+    });
+    return;
+}
+
+template<typename Radix>
+void ArithmeticDivNodeForInteger::DivisionWorkspace::combine(size_t slot, Step step, const Radix base) {
+    BasicIntegerType::ElementType one = 1ull;
+    ElementPtr dividend = get_buffer(0), reciprocal = get_buffer(2), next = get_buffer(3);
+    ElementPtr residual = get_buffer(4), product = get_buffer(5), quotient = get_buffer(6);
+    const size_t length_P = product_length_X + product_length_Y, k = length_A + 1 - length_B;
+    if (step == Step::estimate) {
+        //Q = floor(A_top * V / base ^ (t + n - s)), A_top being A without its lowest s = n - 2 limbs.
+        const size_t shift = precision + 2;
+        length_Q = k + 1;
+        std::fill(quotient, quotient + length_Q, 0ull);
+        if (length_P > shift) {
+            std::copy(product + shift, product + std::min<size_t>(length_P, shift + length_Q), quotient);
+        }
+        schedule(quotient, length_Q, get_buffer(1) + padding, length_B);
+        return;
+    }
+    const size_t h = ladder[slot - first_slot], H = ladder[slot - first_slot + 1];
+    ElementPtr divisor = get_buffer(1) + padding + length_B - H;
+    switch (step) {
+        case Step::residual: {
+            //T = base ^ (H + h) - D_H * V_h, |T| < 3 * base ^ H.
+            const size_t width = H + h + 1;
+            std::fill(residual, residual + width, 0ull);
+            residual[H + h] = 1ull;
+            std::fill(product + length_P, product + width, 0ull);
+            negative = u64_variable_length_integer_compare(product, residual, width) > 0;
+            if (negative) {
+                std::copy(product, product + width, residual);
+                residual[H + h] -= 1ull;
+            } else {
+                u64_variable_length_integer_subtraction_in_place(residual, product, width, width, base);
+            }
+            length_T = u64_variable_length_integer_significant_length(residual, width);
+            schedule(reciprocal, length_V, residual, length_T);
+            break;
+        }
+        case Step::update: {
+            //V_H = V_h * base ^ (H - h) +/- floor(V_h * |T| / base ^ 2h).
+            const size_t width = H + 2;
+            std::fill(next, next + width, 0ull);
+            std::copy(reciprocal, reciprocal + length_V, next + (H - h));
+            if (length_P > (h << 1)) {
+                const size_t span = std::min<size_t>(length_P - (h << 1), width);
+                if (negative) {
+                    u64_variable_length_integer_subtraction_in_place(next, product + (h << 1), width, span, base);
+                } else {
+                    u64_variable_length_integer_addition_in_place(next, product + (h << 1), width, span, base);
+                }
+            }
+            schedule(divisor, H, next, u64_variable_length_integer_significant_length(next, width));
+            break;
+        }
+        case Step::verify: {
+            //Corrects V_H by the exact residual base ^ 2H - D_H * V_H, so that 0 <= residual < D_H.
+            const size_t width = (H << 1) + 3;
+            std::fill(residual, residual + width, 0ull);
+            residual[H << 1] = 1ull;
+            std::fill(product + length_P, product + width, 0ull);
+            if (u64_variable_length_integer_compare(product, residual, width) > 0) {
+                u64_variable_length_integer_subtraction_in_place(product, residual, width, width, base);
+                while (u64_variable_length_integer_significant_length(product, width) > 0) {
+                    u64_variable_length_integer_subtraction_in_place(next, &one, H + 2, 1, base);
+                    if (u64_variable_length_integer_compare_unbalanced(product, width, divisor, H) <= 0) {
+                        break;
+                    }
+                    u64_variable_length_integer_subtraction_in_place(product, divisor, width, H, base);
+                }
+            } else {
+                u64_variable_length_integer_subtraction_in_place(residual, product, width, width, base);
+                while (u64_variable_length_integer_compare_unbalanced(residual, width, divisor, H) >= 0) {
+                    u64_variable_length_integer_addition_in_place(next, &one, H + 2, 1, base);
+                    u64_variable_length_integer_subtraction_in_place(residual, divisor, width, H, base);
+                }
+            }
+            length_V = u64_variable_length_integer_significant_length(next, H + 2);
+            std::copy(next, next + length_V, reciprocal);
+            if (slot + 1 < max_steps) {
+                schedule_iteration(slot + 1);
+            } else {
+                schedule(dividend + length_B - 2, k + 2, reciprocal, length_V);
+            }
+            break;
+        }
+        default: break;
+    }
+    return;
+}
+
+void ArithmeticDivNodeForInteger::DivisionWorkspace::finalize() {
+    if (mode == Mode::newton) {
+        gather();
+    }
+    dispatch_radix(*target_C, [&](auto base) {
+        finalize(base);
+    });
+    source_A.reset();
+    source_B.reset();
+    target_C.reset();
+    putils::release(block);
+    return;
+}
+
+template<typename Radix>
+void ArithmeticDivNodeForInteger::DivisionWorkspace::finalize(const Radix base) {
+    BasicIntegerType::ElementType one = 1ull;
+    ElementPtr residual = get_buffer(4), quotient = get_buffer(6);
+    if (mode == Mode::newton) {
+        //R = A - Q * D, the estimated quotient is off by a few units at most.
+        ElementPtr dividend = get_buffer(0), divisor = get_buffer(1) + padding, product = get_buffer(5);
+        const size_t length_P = product_length_X + product_length_Y, width = length_A + 3;
+        std::fill(product + length_P, product + width, 0ull);
+        std::copy(dividend, dividend + length_A + 1, residual);
+        std::fill(residual + length_A + 1, residual + width, 0ull);
+        if (u64_variable_length_integer_compare(product, residual, width) > 0) {
+            u64_variable_length_integer_subtraction_in_place(product, residual, width, width, base);
+            std::fill(residual, residual + width, 0ull);
+            while (u64_variable_length_integer_significant_length(product, width) > 0) {
+                u64_variable_length_integer_subtraction_in_place(quotient, &one, length_Q, 1, base);
+                if (u64_variable_length_integer_compare_unbalanced(product, width, divisor, length_B) <= 0) {
+                    std::copy(divisor, divisor + length_B, residual);
+                    u64_variable_length_integer_subtraction_in_place(residual, product, width, width, base);
+                    break;
+                }
+                u64_variable_length_integer_subtraction_in_place(product, divisor, width, length_B, base);
+            }
+        } else {
+            u64_variable_length_integer_subtraction_in_place(residual, product, width, width, base);
+            while (u64_variable_length_integer_compare_unbalanced(residual, width, divisor, length_B) >= 0) {
+                u64_variable_length_integer_addition_in_place(quotient, &one, length_Q, 1, base);
+                u64_variable_length_integer_subtraction_in_place(residual, divisor, width, length_B, base);
+            }
+        }
+        u64_variable_length_integer_division_by_small(residual, length_B, factor, base);
+        length_R = length_B;
+    }
+    const size_t length = target_C->len;
+    ElementPtr data_C = target_C->get_pointer();
+    const ElementPtr result = output == Output::quotient ? quotient : residual;
+    const size_t length_result = std::min<size_t>(output == Output::quotient ? length_Q : length_R, length);
+    std::copy(result, result + length_result, data_C);
+    std::fill(data_C + length_result, data_C + length, 0ull);
+    target_C->used_len = u64_variable_length_integer_significant_length(data_C, length_result);
+    const bool zero = target_C->used_len == 0;
+    if (output == Output::quotient) {
+        target_C->sign = (source_A->sign == source_B->sign) || zero;
+    } else {
+        target_C->sign = source_A->sign || zero;
+    }
+    return;
+}
+
+ArithmeticDivNodeForInteger::DivisionStageTaskForInteger::DivisionStageTaskForInteger(
+    const DivisionWorkspaceHandle& workspace,
+    const Stage stage,
+    const Step step,
+    const size_t slot,
+    const size_t index,
+    const ComputeUnitPtr curr_unit
+): workspace(workspace), stage(stage), step(step), slot(slot), index(index), curr_unit(curr_unit) {
+    if (curr_unit == nullptr) {
+        throw PUTILS_GENERAL_EXCEPTION("Unable to bind a task to compute unit pointer (nullptr)!", "DAG construction error");
+    }
+}
+
+void ArithmeticDivNodeForInteger::DivisionStageTaskForInteger::run() {
+    try {
+        switch(stage) {
+            case Stage::prepare: workspace->prepare(); break;
+            case Stage::multiply: workspace->multiply(slot, index); break;
+            case Stage::combine: {
+                if (step == Step::finalize) {
+                    workspace->finalize();
+                } else {
+                    workspace->combine(slot, step);
+                }
+                break;
+            }
+        }
+    } PUTILS_CATCH_THROW_GENERAL
+    workspace.reset();
+    curr_unit->forward();
+    return;
+}
+
+std::string ArithmeticDivNodeForInteger::DivisionStageTaskForInteger::description() const noexcept {
+    static const char* step_names[] = {"residual", "update", "verify", "estimate", "finalize"};
+    std::stringstream ss;
+    ss << "task[" << reinterpret_cast<uintptr_t>(this) << "]:";
+    switch(stage) {
+        case Stage::prepare: ss << "division_prepare_integer:steps[" << workspace->max_steps << "]"; break;
+        case Stage::multiply: ss << "division_multiply_integer:" << step_names[static_cast<int>(step)] << "[" << slot << "],chunk[" << index << "]"; break;
+        case Stage::combine: ss << "division_combine_integer:" << step_names[static_cast<int>(step)] << "[" << slot << "]"; break;
+    }
+    return ss.str();
+}
+
+void ArithmeticDivNodeForInteger::generate_procedure() {
+    using Stage = DivisionStageTaskForInteger::Stage;
+    using Step = DivisionStageTaskForInteger::Step;
+    static const size_t newton_threshold = std::max<int64_t>(GlobalConfig::get_global_config().get_or_else<int64_t>(
+        "Configurations/core/Division/newton_threshold", 64ll
+    ), 2ll);
+    static const size_t min_chunk_length = std::max<int64_t>(GlobalConfig::get_global_config().get_or_else<int64_t>(
+        "Configurations/core/Division/min_chunk_length", 2048ll
+    ), 1ll);
+    static const size_t karatsuba_threshold = std::max<int64_t>(GlobalConfig::get_global_config().get_or_else<int64_t>(
+        "Configurations/core/Multiplication/karatsuba_threshold", 32ll
+    ), 1ll);
+    static const size_t ntt_threshold = std::max<int64_t>(GlobalConfig::get_global_config().get_or_else<int64_t>(
+        "Configurations/core/Multiplication/ntt_threshold", 4096ll
+    ), 1ll);
+    try {
+        const size_t chunks = std::clamp<size_t>(data->len / min_chunk_length, 1, putils::ThreadPool::get_num_executors());
+        auto workspace = std::make_shared<DivisionWorkspace>(
+            operand_A->data, operand_B->data, data, output, chunks, newton_threshold, karatsuba_threshold, ntt_threshold
+        );
+        auto prepare_unit_ptr = std::make_unique<MonoUnit<MultiTaskSynchronizer>>();
+        prepare_unit_ptr->add_task(std::make_shared<DivisionStageTaskForInteger>(workspace, Stage::prepare, Step::residual, 0, 0, prepare_unit_ptr.get()));
+        prepare_unit_ptr->add_dependency(operand_A->get_procedure_port());
+        prepare_unit_ptr->add_dependency(operand_B->get_procedure_port());
+        BasicComputeUnitType* last_unit = prepare_unit_ptr.get();
+        procedure.emplace_back(std::move(prepare_unit_ptr));
+        //Every product unit is followed by the combine unit consuming its partial products.
+        auto append_stage = [&](Step step, size_t slot) {
+            auto multiply_unit_ptr = std::make_unique<ParallelizableUnit<MonoSynchronizer>>();
+            for (size_t i = 0; i < chunks; i++) {
+                multiply_unit_ptr->add_task(std::make_shared<DivisionStageTaskForInteger>(workspace, Stage::multiply, step, slot, i, multiply_unit_ptr.get()));
+            }
+            multiply_unit_ptr->add_dependency(*last_unit);
+            auto combine_unit_ptr = std::make_unique<MonoUnit<MonoSynchronizer>>();
+            combine_unit_ptr->add_task(std::make_shared<DivisionStageTaskForInteger>(workspace, Stage::combine, step, slot, 0, combine_unit_ptr.get()));
+            combine_unit_ptr->add_dependency(*multiply_unit_ptr);
+            last_unit = combine_unit_ptr.get();
+            procedure.emplace_back(std::move(multiply_unit_ptr));
+            procedure.emplace_back(std::move(combine_unit_ptr));
+        };
+        const size_t max_steps = workspace->max_steps;
+        for (size_t slot = 0; slot < max_steps; slot++) {
+            append_stage(Step::residual, slot);
+            append_stage(Step::update, slot);
+            append_stage(Step::verify, slot);
+        }
+        append_stage(Step::estimate, max_steps);
+        append_stage(Step::finalize, max_steps);
+    } PUTILS_CATCH_THROW_GENERAL
+    return;
+}
+
+ArithmeticSqrtNodeForInteger::ArithmeticSqrtNodeForInteger(NodeHandle& node, const Output output): output(output) {
+    node->nexts.emplace_back(this);
+    operand = node.get();
+    if (operand->data == nullptr) {
+        throw PUTILS_GENERAL_EXCEPTION("Operand's data is not initialized.", "DAG construction error");
+    }
+    data = std::make_shared<BasicIntegerType>(operand->data->log_len, operand->data->iobasic, operand->data->radix);
+}
+
+ArithmeticSqrtNodeForInteger::SquareRootWorkspace::SquareRootWorkspace(
+    const DataHandle& source,
+    const DataHandle& target,
+    const Output output,
+    size_t karatsuba_threshold,
+    size_t ntt_threshold
+): source(source),
+   target(target),
+   block(nullptr),
+   output(output),
+   mode(Mode::zero),
+   karatsuba_threshold(karatsuba_threshold),
+   ntt_threshold(ntt_threshold),
+   length_N(0), precision(0), length_Y(0),
+   max_steps(0),
+   first_slot(0),
+   ladder() {
+    //The longest operand needs the longest precision ladder, shorter ones skip the leading iterations.
+    max_steps = u64_sqrt_precision_ladder(((target->len + 1) >> 1) + 2).size() - 1;
+}
+
+ArithmeticSqrtNodeForInteger::SquareRootWorkspace::~SquareRootWorkspace() {
+    putils::release(block);
+}
+
+ArithmeticSqrtNodeForInteger::ElementPtr ArithmeticSqrtNodeForInteger::SquareRootWorkspace::get_buffer(size_t index) const noexcept {
+    //Buffers: 0 extended operand N', 1 reciprocal square root, 2 root, 3 remainder, 4 scratch (8 widths).
+    const size_t width = target->len + 8;
+    return block->get<BasicIntegerType::ElementType>() + width * index;
+}
+
+void ArithmeticSqrtNodeForInteger::SquareRootWorkspace::prepare() {
+    ElementPtr data_A = source->get_ensured_pointer();
+    target->get_ensured_pointer();
+    const size_t length_A = u64_variable_length_integer_significant_length(data_A, std::min<size_t>(source->used_len, target->len));
+    if (length_A == 0) {
+        mode = Mode::zero;
+        return;
+    }
+    if (!source->sign) {
+        mode = Mode::zero;
+        putils::RuntimeLog::get_global_log().add("(Runtime computations): Square root of a negative integer occurred!", putils::RuntimeLog::Level::WARN);
+        return;
+    }
+    try {
+        block = putils::MemoryPool::get_global_memorypool().allocate(((target->len + 8) * 12) * sizeof(BasicIntegerType::ElementType));
+    } PUTILS_CATCH_THROW_GENERAL
+    mode = Mode::newton;
+    length_N = (length_A + 1) & ~static_cast<size_t>(1);
+    precision = (length_N >> 1) + 2;
+    ElementPtr extended = get_buffer(0);
+    std::fill(extended, extended + (precision << 1), 0ull);
+    std::copy(data_A, data_A + length_A, extended + 4);
+    ladder = u64_sqrt_precision_ladder(precision);
+    first_slot = max_steps - (ladder.size() - 1);
+    dispatch_radix(*target, [&](auto base) {
+        length_Y = u64_reciprocal_sqrt_initial(extended + (precision << 1) - 4, get_buffer(1), base);
+    });
+    return;
+}
+
+void ArithmeticSqrtNodeForInteger::SquareRootWorkspace::iterate(size_t slot) {
+    if (mode != Mode::newton || slot < first_slot) {
+        return;
+    }
+    const size_t h = ladder[slot - first_slot], H = ladder[slot - first_slot + 1];
+    dispatch_radix(*target, [&](auto base) {
+        length_Y = u64_reciprocal_sqrt_newton_step(
+            get_buffer(0) + (precision << 1) - (H << 1), H, get_buffer(1), length_Y, h,
+            get_buffer(4), base, karatsuba_threshold, ntt_threshold
+        );
+    });
+    return;
+}
+
+void ArithmeticSqrtNodeForInteger::SquareRootWorkspace::finalize() {
+    const size_t length = target->len;
+    ElementPtr data_C = target->get_pointer();
+    std::fill(data_C, data_C + length, 0ull);
+    target->sign = true;
+    target->used_len = 0;
+    if (mode == Mode::newton) {
+        ElementPtr operand = get_buffer(0) + 4, root = get_buffer(2), remainder = get_buffer(3), scratch = get_buffer(4);
+        dispatch_radix(*target, [&](auto base) {
+            //S = floor(N * Y_P / base ^ (2n + 2)), off by a few units.
+            const size_t length_product = length_N + length_Y, shift = length_N + 2;
+            u64_variable_length_integer_unbalanced_multiplication(operand, get_buffer(1), scratch, length_N, length_Y, base, karatsuba_threshold, ntt_threshold);
+            std::fill(root, root + precision, 0ull);
+            if (length_product > shift) {
+                std::copy(scratch + shift, scratch + std::min<size_t>(length_product, shift + precision), root);
+            }
+            u64_variable_length_integer_sqrt_correction(operand, length_N, root, precision, remainder, scratch, base, karatsuba_threshold, ntt_threshold);
+        });
+        const ElementPtr result = output == Output::root ? root : remainder;
+        const size_t length_result = u64_variable_length_integer_significant_length(result, output == Output::root ? precision : length_N + 1);
+        std::copy(result, result + std::min<size_t>(length_result, length), data_C);
+        target->used_len = std::min<size_t>(length_result, length);
+    }
+    source.reset();
+    target.reset();
+    putils::release(block);
+    return;
+}
+
+ArithmeticSqrtNodeForInteger::SquareRootStageTaskForInteger::SquareRootStageTaskForInteger(
+    const SquareRootWorkspaceHandle& workspace,
+    const Stage stage,
+    const size_t slot,
+    const ComputeUnitPtr curr_unit
+): workspace(workspace), stage(stage), slot(slot), curr_unit(curr_unit) {
+    if (curr_unit == nullptr) {
+        throw PUTILS_GENERAL_EXCEPTION("Unable to bind a task to compute unit pointer (nullptr)!", "DAG construction error");
+    }
+}
+
+void ArithmeticSqrtNodeForInteger::SquareRootStageTaskForInteger::run() {
+    try {
+        switch(stage) {
+            case Stage::prepare: workspace->prepare(); break;
+            case Stage::iterate: workspace->iterate(slot); break;
+            case Stage::finalize: workspace->finalize(); break;
+        }
+    } PUTILS_CATCH_THROW_GENERAL
+    workspace.reset();
+    curr_unit->forward();
+    return;
+}
+
+std::string ArithmeticSqrtNodeForInteger::SquareRootStageTaskForInteger::description() const noexcept {
+    std::stringstream ss;
+    ss << "task[" << reinterpret_cast<uintptr_t>(this) << "]:";
+    switch(stage) {
+        case Stage::prepare: ss << "sqrt_prepare_integer:steps[" << workspace->max_steps << "]"; break;
+        case Stage::iterate: ss << "sqrt_iterate_integer:slot[" << slot << "]"; break;
+        case Stage::finalize: ss << "sqrt_finalize_integer:" << (workspace->output == Output::root ? "root" : "remainder"); break;
+    }
+    return ss.str();
+}
+
+void ArithmeticSqrtNodeForInteger::generate_procedure() {
+    using Stage = SquareRootStageTaskForInteger::Stage;
+    static const size_t karatsuba_threshold = std::max<int64_t>(GlobalConfig::get_global_config().get_or_else<int64_t>(
+        "Configurations/core/Multiplication/karatsuba_threshold", 32ll
+    ), 1ll);
+    static const size_t ntt_threshold = std::max<int64_t>(GlobalConfig::get_global_config().get_or_else<int64_t>(
+        "Configurations/core/Multiplication/ntt_threshold", 4096ll
+    ), 1ll);
+    try {
+        auto workspace = std::make_shared<SquareRootWorkspace>(operand->data, data, output, karatsuba_threshold, ntt_threshold);
+        auto prepare_unit_ptr = std::make_unique<MonoUnit<MultiTaskSynchronizer>>();
+        prepare_unit_ptr->add_task(std::make_shared<SquareRootStageTaskForInteger>(workspace, Stage::prepare, 0, prepare_unit_ptr.get()));
+        prepare_unit_ptr->add_dependency(operand->get_procedure_port());
+        BasicComputeUnitType* last_unit = prepare_unit_ptr.get();
+        procedure.emplace_back(std::move(prepare_unit_ptr));
+        for (size_t slot = 0; slot < workspace->max_steps; slot++) {
+            auto iterate_unit_ptr = std::make_unique<MonoUnit<MonoSynchronizer>>();
+            iterate_unit_ptr->add_task(std::make_shared<SquareRootStageTaskForInteger>(workspace, Stage::iterate, slot, iterate_unit_ptr.get()));
+            iterate_unit_ptr->add_dependency(*last_unit);
+            last_unit = iterate_unit_ptr.get();
+            procedure.emplace_back(std::move(iterate_unit_ptr));
+        }
+        auto finalize_unit_ptr = std::make_unique<MonoUnit<MonoSynchronizer>>();
+        finalize_unit_ptr->add_task(std::make_shared<SquareRootStageTaskForInteger>(workspace, Stage::finalize, 0, finalize_unit_ptr.get()));
+        finalize_unit_ptr->add_dependency(*last_unit);
+        procedure.emplace_back(std::move(finalize_unit_ptr));
+    } PUTILS_CATCH_THROW_GENERAL
+    return;
+}
+
+ArithmeticPowModNodeForInteger::ArithmeticPowModNodeForInteger(NodeHandle& node_A, NodeHandle& node_B, NodeHandle& node_M) {
+    node_A->nexts.emplace_back(this);
+    node_B->nexts.emplace_back(this);
+    node_M->nexts.emplace_back(this);
+    operand_A = node_A.get();
+    operand_B = node_B.get();
+    operand_C = node_M.get();
+    try {
+        check_binary_operands(operand_A, operand_B);
+        check_binary_operands(operand_A, operand_C);
+    } PUTILS_CATCH_THROW_GENERAL
+    data = std::make_shared<BasicIntegerType>(operand_A->data->log_len, operand_A->data->iobasic, operand_A->data->radix);
+}
+
+ArithmeticPowModNodeForInteger::ArithmeticPowModTaskForInteger::ArithmeticPowModTaskForInteger(
+    const DataHandle& source_A,
+    const DataHandle& source_B,
+    const DataHandle& source_M,
+    const DataHandle& target_C,
+    size_t karatsuba_threshold,
+    size_t ntt_threshold,
+    const ComputeUnitPtr curr_unit
+): source_A(source_A),
+   source_B(source_B),
+   source_M(source_M),
+   target_C(target_C),
+   karatsuba_threshold(karatsuba_threshold),
+   ntt_threshold(ntt_threshold),
+   curr_unit(curr_unit) {
+    if (curr_unit == nullptr) {
+        throw PUTILS_GENERAL_EXCEPTION("Unable to bind a task to compute unit pointer (nullptr)!", "DAG construction error");
+    }
+}
+
+template<typename Radix>
+void ArithmeticPowModNodeForInteger::ArithmeticPowModTaskForInteger::exponentiate(ElementPtr modulus, size_t length_M, ElementPtr result, const Radix base) {
+    const size_t length = target_C->len, n = length_M;
+    ElementPtr data_A = source_A->get_pointer(), data_B = source_B->get_pointer();
+    const std::vector<uint64_t> exponent = u64_variable_length_integer_binary_words(data_B, std::min<size_t>(source_B->used_len, length), base);
+    const size_t bits = exponent.empty() ? 0 : (exponent.size() << 6) - std::countl_zero(exponent.back());
+    const size_t slots = u64_sliding_window_table_slots(u64_sliding_window_size(bits));
+    const size_t length_scratch = std::max<size_t>(u64_modulo_scratch_length(std::max<size_t>(length, (n << 1) + 1), n), n + 2);
+    BlockHandle block = nullptr;
+    try {
+        block = putils::MemoryPool::get_global_memorypool().allocate((((n << 1) + 1) * 2 + (n << 1) + length_scratch + slots * n) * sizeof(BasicIntegerType::ElementType));
+    } PUTILS_CATCH_THROW_GENERAL
+    ElementPtr g = block->get<BasicIntegerType::ElementType>(), x = g + n;
+    ElementPtr product = x + n, auxiliary = product + (n << 1) + 1, scratch = auxiliary + (n << 1) + 1, table = scratch + length_scratch;
+    //g = A mod M, taken to the non-negative residue for a negative A.
+    u64_variable_length_integer_modulo(data_A, std::min<size_t>(source_A->used_len, length), modulus, n, g, scratch, base);
+    if (!source_A->sign && u64_variable_length_integer_significant_length(g, n) != 0) {
+        u64_variable_length_integer_subtraction_with_carry_a_ge_b(modulus, g, g, n, base);
+    }
+    if (u64_is_binary_radix(base) && (modulus[0] & 1ull) != 0ull) {
+        const uint64_t inverse = u64_montgomery_inverse(modulus[0], base);
+        auto multiply = [&](u64arr c, const u64arr a, const u64arr b) {
+            u64_montgomery_multiplication(a, b, c, modulus, n, inverse, scratch, base);
+        };
+        //x = R mod M is the Montgomery form of 1, R ^ 2 mod M brings g into Montgomery form.
+        std::fill(product, product + (n << 1) + 1, 0ull);
+        product[n] = 1ull;
+        u64_variable_length_integer_modulo(product, n + 1, modulus, n, x, scratch, base);
+        product[n] = 0ull;
+        product[n << 1] = 1ull;
+        u64_variable_length_integer_modulo(product, (n << 1) + 1, modulus, n, auxiliary, scratch, base);
+        multiply(g, g, auxiliary);
+        u64_sliding_window_exponentiation(x, g, exponent, n, table, multiply);
+        //Multiplying by 1 leaves the Montgomery form.
+        std::fill(auxiliary, auxiliary + n, 0ull);
+        auxiliary[0] = 1ull;
+        multiply(x, x, auxiliary);
+    } else {
+        auto multiply = [&](u64arr c, const u64arr a, const u64arr b) {
+            u64_variable_length_integer_unbalanced_multiplication(a, b, product, n, n, base, karatsuba_threshold, ntt_threshold);
+            u64_variable_length_integer_modulo(product, n << 1, modulus, n, c, scratch, base);
+        };
+        std::fill(x, x + n, 0ull);
+        x[0] = n > 1 || modulus[0] > 1ull ? 1ull : 0ull;
+        u64_sliding_window_exponentiation(x, g, exponent, n, table, multiply);
+    }
+    std::copy(x, x + n, result);
+    putils::release(block);
+    return;
+}
+
+void ArithmeticPowModNodeForInteger::ArithmeticPowModTaskForInteger::run() {
+    try {
+        ElementPtr data_B = source_B->get_ensured_pointer();
+        ElementPtr data_M = source_M->get_ensured_pointer();
+        ElementPtr data_C = target_C->get_ensured_pointer();
+        source_A->get_ensured_pointer();
+        const size_t length = target_C->len;
+        const size_t length_M = u64_variable_length_integer_significant_length(data_M, std::min<size_t>(source_M->used_len, length));
+        std::fill(data_C, data_C + length, 0ull);
+        target_C->sign = true;
+        target_C->used_len = 0;
+        if (length_M == 0) {
+            putils::RuntimeLog::get_global_log().add("(Runtime computations): Modular exponentiation by a zero modulus occurred!", putils::RuntimeLog::Level::WARN);
+        } else if (!source_B->sign && u64_variable_length_integer_significant_length(data_B, std::min<size_t>(source_B->used_len, length)) != 0) {
+            putils::RuntimeLog::get_global_log().add("(Runtime computations): Modular exponentiation by a negative exponent occurred!", putils::RuntimeLog::Level::WARN);
+        } else {
+            //The sign of the modulus is ignored.
+            dispatch_radix(*target_C, [&](auto base) {
+                exponentiate(data_M, length_M, data_C, base);
+            });
+            target_C->used_len = u64_variable_length_integer_significant_length(data_C, length_M);
+        }
+    } PUTILS_CATCH_THROW_GENERAL
+    curr_unit->forward();
+    return;
+}
+
+std::string ArithmeticPowModNodeForInteger::ArithmeticPowModTaskForInteger::description() const noexcept {
+    std::stringstream ss;
+    ss << "task[" << reinterpret_cast<uintptr_t>(this) << "]:powmod_integer:len[" << target_C->len << "]";
+    return ss.str();
+}
+
+void ArithmeticPowModNodeForInteger::generate_procedure() {
+    static const size_t karatsuba_threshold = std::max<int64_t>(GlobalConfig::get_global_config().get_or_else<int64_t>(
+        "Configurations/core/Multiplication/karatsuba_threshold", 32ll
+    ), 1ll);
+    static const size_t ntt_threshold = std::max<int64_t>(GlobalConfig::get_global_config().get_or_else<int64_t>(
+        "Configurations/core/Multiplication/ntt_threshold", 4096ll
+    ), 1ll);
+    try {
+        auto compute_unit_ptr = std::make_unique<MonoUnit<MultiTaskSynchronizer>>();
+        compute_unit_ptr->add_task(std::make_shared<ArithmeticPowModTaskForInteger>(
+            operand_A->data, operand_B->data, operand_C->data, data, karatsuba_threshold, ntt_threshold, compute_unit_ptr.get()
+        ));
+        compute_unit_ptr->add_dependency(operand_A->get_procedure_port());
+        compute_unit_ptr->add_dependency(operand_B->get_procedure_port());
+        compute_unit_ptr->add_dependency(operand_C->get_procedure_port());
+        procedure.emplace_back(std::move(compute_unit_ptr));
+    } PUTILS_CATCH_THROW_GENERAL
+    return;
+}
+
+ArithmeticGcdNodeForInteger::ArithmeticGcdNodeForInteger(NodeHandle& node_A, NodeHandle& node_B, const Output output): output(output) {
+    node_A->nexts.emplace_back(this);
+    node_B->nexts.emplace_back(this);
+    operand_A = node_A.get();
+    operand_B = node_B.get();
+    try {
+        check_binary_operands(operand_A, operand_B);
+    } PUTILS_CATCH_THROW_GENERAL
+    data = std::make_shared<BasicIntegerType>(operand_A->data->log_len, operand_A->data->iobasic, operand_A->data->radix);
+}
+
+ArithmeticGcdNodeForInteger::ArithmeticGcdTaskForInteger::ArithmeticGcdTaskForInteger(
+    const DataHandle& source_A,
+    const DataHandle& source_B,
+    const DataHandle& target_C,
+    const Output output,
+    size_t hgcd_threshold,
+    size_t karatsuba_threshold,
+    size_t ntt_threshold,
+    const ComputeUnitPtr curr_unit
+): source_A(source_A),
+   source_B(source_B),
+   target_C(target_C),
+   output(output),
+   hgcd_threshold(hgcd_threshold),
+   karatsuba_threshold(karatsuba_threshold),
+   ntt_threshold(ntt_threshold),
+   curr_unit(curr_unit) {
+    if (curr_unit == nullptr) {
+        throw PUTILS_GENERAL_EXCEPTION("Unable to bind a task to compute unit pointer (nullptr)!", "DAG construction error");
+    }
+}
+
+void ArithmeticGcdNodeForInteger::ArithmeticGcdTaskForInteger::run() {
+    try {
+        ElementPtr data_A = source_A->get_ensured_pointer();
+        ElementPtr data_B = source_B->get_ensured_pointer();
+        ElementPtr data_C = target_C->get_ensured_pointer();
+        const size_t length = target_C->len;
+        u64vec a(data_A, data_A + u64_variable_length_integer_significant_length(data_A, std::min<size_t>(source_A->used_len, length)));
+        u64vec b(data_B, data_B + u64_variable_length_integer_significant_length(data_B, std::min<size_t>(source_B->used_len, length)));
+        u64vec result;
+        bool sign = true;
+        dispatch_radix(*target_C, [&](auto base) {
+            if (output == Output::gcd) {
+                u64_variable_length_integer_gcd(a, b, nullptr, base, hgcd_threshold, karatsuba_threshold, ntt_threshold);
+                result = std::move(a);
+            } else if (!a.empty() || !b.empty()) {
+                //G = det(M) (m11 |A| - m01 |B|) for (|A|, |B|) = M (G, 0).
+                GcdMatrix M;
+                u64_variable_length_integer_gcd(a, b, &M, base, hgcd_threshold, karatsuba_threshold, ntt_threshold);
+                const bool first = output == Output::cofactor_A;
+                result = std::move(M.entries[first ? 3 : 1]);
+                sign = first ? !M.odd : M.odd;
+                sign = (first ? source_A->sign : source_B->sign) ? sign : !sign;
+            }
+        });
+        std::fill(data_C, data_C + length, 0ull);
+        std::copy(result.begin(), result.begin() + std::min<size_t>(result.size(), length), data_C);
+        target_C->used_len = u64_variable_length_integer_significant_length(data_C, std::min<size_t>(result.size(), length));
+        target_C->sign = result.empty() ? true : sign;
+    } PUTILS_CATCH_THROW_GENERAL
+    curr_unit->forward();
+    return;
+}
+
+std::string ArithmeticGcdNodeForInteger::ArithmeticGcdTaskForInteger::description() const noexcept {
+    std::stringstream ss;
+    ss << "task[" << reinterpret_cast<uintptr_t>(this) << "]:gcd_integer:";
+    switch(output) {
+        case Output::gcd: ss << "gcd"; break;
+        case Output::cofactor_A: ss << "cofactor_A"; break;
+        case Output::cofactor_B: ss << "cofactor_B"; break;
+    }
+    return ss.str();
+}
+
+void ArithmeticGcdNodeForInteger::generate_procedure() {
+    static const size_t hgcd_threshold = std::max<int64_t>(GlobalConfig::get_global_config().get_or_else<int64_t>(
+        "Configurations/core/GCD/hgcd_threshold", 128ll
+    ), 4ll);
+    static const size_t karatsuba_threshold = std::max<int64_t>(GlobalConfig::get_global_config().get_or_else<int64_t>(
+        "Configurations/core/Multiplication/karatsuba_threshold", 32ll
+    ), 1ll);
+    static const size_t ntt_threshold = std::max<int64_t>(GlobalConfig::get_global_config().get_or_else<int64_t>(
+        "Configurations/core/Multiplication/ntt_threshold", 4096ll
+    ), 1ll);
+    try {
+        auto compute_unit_ptr = std::make_unique<MonoUnit<MultiTaskSynchronizer>>();
+        compute_unit_ptr->add_task(std::make_shared<ArithmeticGcdTaskForInteger>(
+            operand_A->data, operand_B->data, data, output, hgcd_threshold, karatsuba_threshold, ntt_threshold, compute_unit_ptr.get()
+        ));
+        compute_unit_ptr->add_dependency(operand_A->get_procedure_port());
+        compute_unit_ptr->add_dependency(operand_B->get_procedure_port());
+        procedure.emplace_back(std::move(compute_unit_ptr));
+    } PUTILS_CATCH_THROW_GENERAL
+    return;
+}
+
+ArithmeticCompareNodeForInteger::ArithmeticCompareNodeForInteger(NodeHandle& node_A, NodeHandle& node_B, const Relation relation): relation(relation) {
+    node_A->nexts.emplace_back(this);
+    node_B->nexts.emplace_back(this);
+    operand_A = node_A.get();
+    operand_B = node_B.get();
+    try {
+        check_binary_operands(operand_A, operand_B);
+    } PUTILS_CATCH_THROW_GENERAL
+    data = std::make_shared<BasicIntegerType>(operand_A->data->log_len, operand_A->data->iobasic, operand_A->data->radix);
+}
+
+ArithmeticCompareNodeForInteger::ArithmeticCompareTaskForInteger::ArithmeticCompareTaskForInteger(
+    const DataHandle& source_A,
+    const DataHandle& source_B,
+    const DataHandle& target_C,
+    const Relation relation,
+    const ComputeUnitPtr curr_unit
+): source_A(source_A), source_B(source_B), target_C(target_C), relation(relation), curr_unit(curr_unit) {
+    if (curr_unit == nullptr) {
+        throw PUTILS_GENERAL_EXCEPTION("Unable to bind a task to compute unit pointer (nullptr)!", "DAG construction error");
+    }
+}
+
+void ArithmeticCompareNodeForInteger::ArithmeticCompareTaskForInteger::run() {
+    try {
+        ElementPtr data_A = source_A->get_ensured_pointer();
+        ElementPtr data_B = source_B->get_ensured_pointer();
+        ElementPtr data_C = target_C->get_ensured_pointer();
+        //Zeros are positive, so operands of opposite signs are ordered by their signs alone.
+        int order = source_A->sign ? 1 : -1;
+        if (source_A->sign == source_B->sign) {
+            order *= u64_variable_length_integer_compare_unbalanced(
+                data_A, std::min<size_t>(source_A->used_len, source_A->len),
+                data_B, std::min<size_t>(source_B->used_len, source_B->len)
+            );
+        }
+        int result = order;
+        switch (relation) {
+            case Relation::compare: break;
+            case Relation::less: result = order < 0 ? 1 : 0; break;
+            case Relation::equal: result = order == 0 ? 1 : 0; break;
+        }
+        //A single limb of 1 holds the magnitude in every radix, the limbs above are zeros since the allocation.
+        data_C[0] = result != 0 ? 1ull : 0ull;
+        target_C->used_len = result != 0 ? 1 : 0;
+        target_C->sign = result >= 0;
+    } PUTILS_CATCH_THROW_GENERAL
+    source_A.reset();
+    source_B.reset();
+    target_C.reset();
+    curr_unit->forward();
+    return;
+}
+
+std::string ArithmeticCompareNodeForInteger::ArithmeticCompareTaskForInteger::description() const noexcept {
+    std::stringstream ss;
+    ss << "task[" << reinterpret_cast<uintptr_t>(this) << "]:arithmetic_compare_integer:";
+    ss << "source_A[" << source_A->get_status() << "],source_B[" << source_B->get_status() << "],target_C[" << target_C->get_status() << "],relation:";
+    switch (relation) {
+        case Relation::compare: ss << "cmp"; break;
+        case Relation::less: ss << "less"; break;
+        case Relation::equal: ss << "equal"; break;
+    }
+    return ss.str();
+}
+
+void ArithmeticCompareNodeForInteger::generate_procedure() {
+    try {
+        auto compute_unit_ptr = std::make_unique<MonoUnit<MultiTaskSynchronizer>>();
+        compute_unit_ptr->add_task(std::make_shared<ArithmeticCompareTaskForInteger>(operand_A->data, operand_B->data, data, relation, compute_unit_ptr.get()));
+        compute_unit_ptr->add_dependency(operand_A->get_procedure_port());
+        compute_unit_ptr->add_dependency(operand_B->get_procedure_port());
+        procedure.emplace_back(std::move(compute_unit_ptr));
+    } PUTILS_CATCH_THROW_GENERAL
+    return;
+}
+
+void ArithmeticCompareNodeForInteger::estimate_bound() noexcept {
+    bound = 1;
+    return;
+}
+
+ArithmeticSelectNodeForInteger::ArithmeticSelectNodeForInteger(NodeHandle& node_P, NodeHandle& node_A, NodeHandle& node_B) {
+    node_P->nexts.emplace_back(this);
+    node_A->nexts.emplace_back(this);
+    node_B->nexts.emplace_back(this);
+    operand_A = node_P.get();
+    operand_B = node_A.get();
+    operand_C = node_B.get();
+    try {
+        check_binary_operands(operand_A, operand_B);
+        check_binary_operands(operand_A, operand_C);
+    } PUTILS_CATCH_THROW_GENERAL
+    data = std::make_shared<BasicIntegerSelection>(operand_B->data, operand_C->data);
+}
+
+ArithmeticSelectNodeForInteger::ArithmeticSelectTaskForInteger::ArithmeticSelectTaskForInteger(
+    const DataHandle& predicate,
+    const DataHandle& target,
+    const ComputeUnitPtr curr_unit
+): predicate(predicate), target(target), curr_unit(curr_unit) {
+    if (curr_unit == nullptr) {
+        throw PUTILS_GENERAL_EXCEPTION("Unable to bind a task to compute unit pointer (nullptr)!", "DAG construction error");
+    }
+}
+
+void ArithmeticSelectNodeForInteger::ArithmeticSelectTaskForInteger::run() {
+    try {
+        BasicIntegerType::ElementType* data_P = predicate->get_ensured_pointer();
+        const bool holds = u64_variable_length_integer_significant_length(data_P, std::min<size_t>(predicate->used_len, predicate->len)) != 0;
+        //The selection is bound only after the choice, the unselected candidate is dropped from its views.
+        auto selection = std::static_pointer_cast<BasicIntegerSelection>(target);
+        selection->choose(!holds);
+        selection->get_ensured_pointer();
+        selection->used_len = selection->source->used_len;
+        selection->sign = selection->source->sign;
+    } PUTILS_CATCH_THROW_GENERAL
+    predicate.reset();
+    target.reset();
+    curr_unit->forward();
+    return;
+}
+
+std::string ArithmeticSelectNodeForInteger::ArithmeticSelectTaskForInteger::description() const noexcept {
+    std::stringstream ss;
+    ss << "task[" << reinterpret_cast<uintptr_t>(this) << "]:arithmetic_select_integer:";
+    ss << "predicate[" << predicate->get_status() << "],target[" << target->get_status() << "]";
+    return ss.str();
+}
+
+void ArithmeticSelectNodeForInteger::generate_procedure() {
+    try {
+        auto compute_unit_ptr = std::make_unique<MonoUnit<MultiTaskSynchronizer>>();
+        compute_unit_ptr->add_task(std::make_shared<ArithmeticSelectTaskForInteger>(operand_A->data, data, compute_unit_ptr.get()));
+        compute_unit_ptr->add_dependency(operand_A->get_procedure_port());
+        compute_unit_ptr->add_dependency(operand_B->get_procedure_port());
+        compute_unit_ptr->add_dependency(operand_C->get_procedure_port());
+        procedure.emplace_back(std::move(compute_unit_ptr));
+    } PUTILS_CATCH_THROW_GENERAL
+    return;
+}
+
+void ArithmeticSelectNodeForInteger::estimate_bound() noexcept {
+    bound = std::max<size_t>(operand_B->bound, operand_C->bound);
+    return;
+}
+
 }
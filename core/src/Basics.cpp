@@ -1,9 +1,12 @@
 #include "Basics.h"
 
+#include "ArithmeticFunctions.hpp"
+#include "DivisionFunctions.hpp"
+
 namespace mpengine {
 
-BasicIntegerType::BasicIntegerType(size_t log_len, IOBasic iobasic): 
-sign(1), log_len(log_len), len(0), data(nullptr), iobasic(iobasic) {
+BasicIntegerType::BasicIntegerType(size_t log_len, IOBasic iobasic, StoreRadix radix): 
+sign(1), log_len(log_len), len(0), data(nullptr), iobasic(iobasic), radix(radix), used_len(0), packed(nullptr), packed_flag(false), widening_lock(), views(0) {
     //auto& memorypool = putils::MemoryPool::get_global_memorypool();
     static const size_t min_log_length = GlobalConfig::get_global_config().get_or_else<int64_t>(
         "Configurations/core/BasicIntegerType/limits/min_log_length", 0ll
@@ -30,6 +33,7 @@ sign(1), log_len(log_len), len(0), data(nullptr), iobasic(iobasic) {
         );
     }
     len = 1ull << log_len;
+    used_len = len;
     if (!delayed_allocation) {
         try {
             allocate();
@@ -39,16 +43,88 @@ sign(1), log_len(log_len), len(0), data(nullptr), iobasic(iobasic) {
 
 BasicIntegerType::~BasicIntegerType() {
     putils::release(data);
+    putils::release(packed);
 }
 
 void BasicIntegerType::allocate() {
+    if (packed_flag.load(std::memory_order_acquire)) {
+        try {
+            widen();
+        } PUTILS_CATCH_THROW_GENERAL
+        return;
+    }
     if (data != nullptr) {
         return;
     }
     try {
         data = putils::MemoryPool::get_global_memorypool().allocate(len * sizeof(ElementType));
-        memset(data->get<ElementType>(), 0, len * sizeof(ElementType));
     } PUTILS_CATCH_THROW_GENERAL
+    memset(data->get<ElementType>(), 0, len * sizeof(ElementType));
+    return;
+}
+
+void BasicIntegerType::widen() {
+    //The consumers of a packed integer may run concurrently, each of them widens it in its own task.
+    std::lock_guard<std::mutex> lock(widening_lock);
+    if (!packed_flag.load(std::memory_order_acquire)) {
+        return;
+    }
+    try {
+        data = putils::MemoryPool::get_global_memorypool().allocate(len * sizeof(ElementType));
+    } PUTILS_CATCH_THROW_GENERAL
+    ElementType* arr = data->get<ElementType>();
+    const uint32_t* narrow = packed->get<uint32_t>();
+    const size_t used = std::min<size_t>(used_len, len);
+    std::copy(narrow, narrow + used, arr);
+    memset(arr + used, 0, (len - used) * sizeof(ElementType));
+    putils::release(packed);
+    packed_flag.store(false, std::memory_order_release);
+    return;
+}
+
+void BasicIntegerType::pack() {
+    static const bool packed_limbs = GlobalConfig::get_global_config().get_or_else<bool>(
+        "Configurations/core/MemoryPreference/packed_limbs", false
+    );
+    //A view may share the block, which must stay in place then. Only compact limbs fit in 32 bits.
+    if (!packed_limbs || radix != StoreRadix::compact || data == nullptr || views.load() != 0) {
+        return;
+    }
+    ElementType* arr = data->get<ElementType>();
+    const size_t used = u64_variable_length_integer_significant_length(arr, std::min<size_t>(used_len, len));
+    try {
+        packed = putils::MemoryPool::get_global_memorypool().allocate(std::max<size_t>(used, 1) * sizeof(uint32_t));
+    } PUTILS_CATCH_THROW_GENERAL
+    std::copy(arr, arr + used, packed->get<uint32_t>());
+    putils::release(data);
+    used_len = used;
+    packed_flag.store(true, std::memory_order_release);
+    return;
+}
+
+void BasicIntegerType::resize(size_t log_len) {
+    static const size_t max_log_length = GlobalConfig::get_global_config().get_or_else<int64_t>(
+        "Configurations/core/BasicIntegerType/limits/max_log_length", 0ll
+    );
+    log_len = std::min<size_t>(log_len, max_log_length);
+    if (log_len <= this->log_len) {
+        return;
+    }
+    const size_t new_len = 1ull << log_len;
+    if (data != nullptr) {
+        //The limbs from used_len on are zeros, so the used ones are all the new block needs.
+        const size_t used = std::min<size_t>(used_len, len);
+        BlockHandle block = nullptr;
+        try {
+            block = putils::MemoryPool::get_global_memorypool().allocate(new_len * sizeof(ElementType));
+        } PUTILS_CATCH_THROW_GENERAL
+        memcpy(block->get<ElementType>(), data->get<ElementType>(), used * sizeof(ElementType));
+        memset(block->get<ElementType>() + used, 0, (new_len - used) * sizeof(ElementType));
+        putils::release(data);
+        data = block;
+    }
+    this->log_len = log_len;
+    len = new_len;
     return;
 }
 
@@ -64,13 +140,95 @@ BasicIntegerType::ElementType* BasicIntegerType::get_ensured_pointer() {
 }
 
 const char* BasicIntegerType::get_status() const noexcept {
-    if (data == nullptr) {
+    if (data == nullptr && packed != nullptr) {
+        return "packed";
+    } else if (data == nullptr) {
         return "null_yet";
     } else {
         return "allocated";
     }
 }
 
+BasicIntegerView::BasicIntegerView(const std::shared_ptr<BasicIntegerType>& source):
+BasicIntegerType(source->log_len, source->iobasic, source->radix), source(source) {
+    //Without delayed allocation the base constructor has already allocated a block of its own.
+    putils::release(data);
+    source->views++;
+}
+
+BasicIntegerView::~BasicIntegerView() {
+    //The block belongs to the source, it is detached here so that the base destructor does not release it.
+    data.reset();
+    source->views--;
+}
+
+void BasicIntegerView::allocate() {
+    if (data != nullptr) {
+        return;
+    }
+    try {
+        source->allocate();
+    } PUTILS_CATCH_THROW_GENERAL
+    data = source->data;
+    return;
+}
+
+void BasicIntegerView::pack() {}
+
+void BasicIntegerView::resize(size_t log_len) {
+    //The source grows (once for all of its views) and the view binds its new block, if it was bound to the old one.
+    try {
+        source->resize(log_len);
+    } PUTILS_CATCH_THROW_GENERAL
+    if (data != nullptr) {
+        data = source->data;
+    }
+    this->log_len = source->log_len;
+    len = source->len;
+    return;
+}
+
+BasicIntegerSelection::BasicIntegerSelection(const std::shared_ptr<BasicIntegerType>& source, const std::shared_ptr<BasicIntegerType>& alternative):
+BasicIntegerView(source), alternative(alternative) {
+    alternative->views++;
+}
+
+BasicIntegerSelection::~BasicIntegerSelection() {
+    if (alternative != nullptr) {
+        alternative->views--;
+    }
+}
+
+void BasicIntegerSelection::resize(size_t log_len) {
+    //Both candidates grow until the choice, the selection binds the block of the chosen one later.
+    if (alternative != nullptr) {
+        try {
+            alternative->resize(log_len);
+        } PUTILS_CATCH_THROW_GENERAL
+    }
+    try {
+        BasicIntegerView::resize(log_len);
+    } PUTILS_CATCH_THROW_GENERAL
+    return;
+}
+
+void BasicIntegerSelection::choose(bool alternative_chosen) {
+    if (alternative == nullptr) {
+        return;
+    }
+    if (alternative_chosen) {
+        std::swap(source, alternative);
+        log_len = source->log_len;
+        len = source->len;
+    }
+    //The dropped candidate may be packed again at rest.
+    alternative->views--;
+    alternative.reset();
+    return;
+}
+
+thread_local size_t BasicComputeUnitType::serialize_depth = 0;
+
 BasicComputeUnitType::BasicComputeUnitType(): forward_calls() {}
 
 BasicComputeUnitType::~BasicComputeUnitType() {}
@@ -96,7 +254,7 @@ void BasicComputeUnitType::generate_task_stn() const noexcept {
     return;
 }
 
-BasicNodeType::BasicNodeType(): data(nullptr), nexts(), procedure() {}
+BasicNodeType::BasicNodeType(): data(nullptr), nexts(), procedure(), bound(0) {}
 
 BasicNodeType::~BasicNodeType() {}
 
@@ -109,16 +267,60 @@ BasicComputeUnitType& BasicNodeType::get_procedure_port() {
     return *(procedure.back());
 }
 
+void BasicNodeType::replace_operand(NodePtr, NodePtr) noexcept {}
+
+void BasicNodeType::estimate_bound() noexcept {
+    bound = data != nullptr ? data->len : 0;
+    return;
+}
+
 BasicTransformation::BasicTransformation(): operand(nullptr) {}
 
 BasicTransformation::~BasicTransformation() {}
 
+void BasicTransformation::replace_operand(NodePtr node, NodePtr replacement) noexcept {
+    operand = operand == node ? replacement : operand;
+    return;
+}
+
+void BasicTransformation::estimate_bound() noexcept {
+    bound = operand->bound;
+    return;
+}
+
 BasicBinaryOperation::BasicBinaryOperation(): operand_A(nullptr), operand_B(nullptr) {}
 
 BasicBinaryOperation::~BasicBinaryOperation() {}
 
-ConstantNode::ConstantNode(size_t log_len, IOBasic iobasic) {
-    data = std::make_shared<BasicIntegerType>(log_len, iobasic);
+void BasicBinaryOperation::replace_operand(NodePtr node, NodePtr replacement) noexcept {
+    operand_A = operand_A == node ? replacement : operand_A;
+    operand_B = operand_B == node ? replacement : operand_B;
+    return;
+}
+
+void BasicBinaryOperation::estimate_bound() noexcept {
+    bound = std::max<size_t>(operand_A->bound, operand_B->bound);
+    return;
+}
+
+BasicTernaryOperation::BasicTernaryOperation(): operand_A(nullptr), operand_B(nullptr), operand_C(nullptr) {}
+
+BasicTernaryOperation::~BasicTernaryOperation() {}
+
+void BasicTernaryOperation::replace_operand(NodePtr node, NodePtr replacement) noexcept {
+    operand_A = operand_A == node ? replacement : operand_A;
+    operand_B = operand_B == node ? replacement : operand_B;
+    operand_C = operand_C == node ? replacement : operand_C;
+    return;
+}
+
+void BasicTernaryOperation::estimate_bound() noexcept {
+    bound = std::max<size_t>({operand_A->bound, operand_B->bound, operand_C->bound});
+    return;
+}
+
+ConstantNode::ConstantNode(size_t log_len, IOBasic iobasic, StoreRadix radix) {
+    data = std::make_shared<BasicIntegerType>(log_len, iobasic, radix);
 }
 
 ConstantNode::ConstantNode(const BasicNodeType& node) {
@@ -134,10 +336,279 @@ void ConstantNode::generate_procedure() {
     if (data == nullptr) {
         throw PUTILS_GENERAL_EXCEPTION("Constant node with empty data domain.", "DAG construction error");
     }
+    //A packed constant is widened by the first consuming task allocating it (see BasicIntegerType::widen()).
     procedure.emplace_back(std::make_unique<BasicComputeUnitType>());
     return;
 }
 
+void ConstantNode::estimate_bound() noexcept {
+    bound = std::min<size_t>(data->used_len, data->len);
+    return;
+}
+
+/*
+ * Native limbs are converted through chunks of log_store_base(iobasic, StoreRadix::native) io digits:
+ * hex chunks are exactly the limbs, octal chunks are 63-bit fields of the limb bit string,
+ * and decimal chunks are the base 10 ^ 19 digits, converted by divide and conquer over the powers
+ * P_k = (10 ^ 19) ^ (2 ^ k): parsing multiplies the value of the high chunks by P_k and adds the low ones,
+ * printing divides by P_k (through its reciprocal) and converts the quotient and the remainder.
+ * Both cost O(M(n) log n), the chunk by chunk conversion is left to the leaves of native_decimal_leaf_chunks chunks.
+ */
+
+constexpr const uint64_t native_decimal_chunk_base = 10000000000000000000ull;
+constexpr const size_t native_decimal_leaf_chunks = 256;
+
+struct NativeDecimalPowers {
+    //powers[k] = P_k, and for the divisions divisors[k] = P_k * 2 ^ shifts[k] (top bit set) with its reciprocal.
+    std::vector<std::vector<BasicIntegerType::ElementType>> powers, divisors, reciprocals;
+    std::vector<uint64_t> shifts;
+    size_t karatsuba_threshold, ntt_threshold, newton_threshold;
+    NativeDecimalPowers();
+    void square();
+    void invert(size_t level);
+};
+
+NativeDecimalPowers::NativeDecimalPowers(): powers{{native_decimal_chunk_base}}, divisors(), reciprocals(), shifts() {
+    karatsuba_threshold = std::max<int64_t>(GlobalConfig::get_global_config().get_or_else<int64_t>(
+        "Configurations/core/Multiplication/karatsuba_threshold", 32ll
+    ), 1ll);
+    ntt_threshold = std::max<int64_t>(GlobalConfig::get_global_config().get_or_else<int64_t>(
+        "Configurations/core/Multiplication/ntt_threshold", 4096ll
+    ), 1ll);
+    newton_threshold = std::max<int64_t>(GlobalConfig::get_global_config().get_or_else<int64_t>(
+        "Configurations/core/Division/newton_threshold", 64ll
+    ), 2ll);
+}
+
+void NativeDecimalPowers::square() {
+    //Appends P_(k + 1) = P_k ^ 2.
+    auto& power = powers.back();
+    std::vector<BasicIntegerType::ElementType> next(power.size() << 1);
+    u64_variable_length_integer_unbalanced_multiplication(
+        power.data(), power.data(), next.data(), power.size(), power.size(), NativeRadix{}, karatsuba_threshold, ntt_threshold
+    );
+    next.resize(u64_variable_length_integer_significant_length(next.data(), next.size()));
+    powers.emplace_back(std::move(next));
+    return;
+}
+
+void NativeDecimalPowers::invert(size_t level) {
+    //Normalizes P_level (at least 2 limbs above the leaves) and computes its reciprocal once.
+    if (divisors.size() <= level) {
+        divisors.resize(level + 1);
+        reciprocals.resize(level + 1);
+        shifts.resize(level + 1, 0);
+    }
+    if (!divisors[level].empty()) {
+        return;
+    }
+    auto& power = powers[level];
+    const size_t n = power.size();
+    shifts[level] = std::countl_zero(power.back());
+    divisors[level].assign(n, 0ull);
+    reciprocals[level].assign(n + 1, 0ull);
+    u64_variable_length_integer_multiply_add_small(divisors[level].data(), power.data(), n, n, 1ull << shifts[level], NativeRadix{});
+    u64_variable_length_integer_reciprocal(
+        divisors[level].data(), n, reciprocals[level].data(), NativeRadix{}, newton_threshold, karatsuba_threshold, ntt_threshold
+    );
+    return;
+}
+
+void parse_native_decimal_chunks(const BasicIntegerType::ElementType* chunks, const size_t count, NativeDecimalPowers& powers, BasicIntegerType::ElementType* limbs) {
+    //Writes the value of count chunks into count limbs (10 ^ 19 < 2 ^ 64).
+    std::fill(limbs, limbs + count, 0ull);
+    if (count <= native_decimal_leaf_chunks) {
+        size_t used = 0;
+        for (size_t k = count; k-- > 0; ) {
+            BasicIntegerType::ElementType carry = chunks[k];
+            for (size_t i = 0; i < used; i++) {
+                const unsigned __int128 total = static_cast<unsigned __int128>(limbs[i]) * native_decimal_chunk_base + carry;
+                limbs[i] = static_cast<BasicIntegerType::ElementType>(total);
+                carry = static_cast<BasicIntegerType::ElementType>(total >> 64);
+            }
+            if (carry != 0ull) {
+                limbs[used++] = carry;
+            }
+        }
+        return;
+    }
+    //The low half takes 2 ^ level chunks, the largest power of 2 below count.
+    const size_t level = std::bit_width(count - 1) - 1, half = 1ull << level;
+    while (powers.powers.size() <= level) {
+        powers.square();
+    }
+    auto& power = powers.powers[level];
+    std::vector<BasicIntegerType::ElementType> high(count - half), low(half);
+    parse_native_decimal_chunks(chunks, half, powers, low.data());
+    parse_native_decimal_chunks(chunks + half, count - half, powers, high.data());
+    const size_t length_high = std::max<size_t>(u64_variable_length_integer_significant_length(high.data(), count - half), 1);
+    u64_variable_length_integer_unbalanced_multiplication(
+        high.data(), power.data(), limbs, length_high, power.size(), NativeRadix{}, powers.karatsuba_threshold, powers.ntt_threshold
+    );
+    u64_variable_length_integer_addition_in_place(limbs, low.data(), count, half, NativeRadix{});
+    return;
+}
+
+void print_native_decimal_chunks(BasicIntegerType::ElementType* limbs, const size_t length, const size_t level, NativeDecimalPowers& powers, BasicIntegerType::ElementType* chunks) {
+    //Writes exactly 2 ^ (level + 1) chunks of a value below P_(level + 1), the leading ones may be zeros.
+    const size_t count = 2ull << level;
+    if (count <= native_decimal_leaf_chunks) {
+        std::vector<BasicIntegerType::ElementType> quotient(limbs, limbs + length);
+        size_t used = u64_variable_length_integer_significant_length(quotient.data(), length);
+        for (size_t k = 0; k < count; k++) {
+            chunks[k] = used > 0 ? u64_variable_length_integer_division_by_small(quotient.data(), used, native_decimal_chunk_base, NativeRadix{}) : 0ull;
+            while (used > 0 && quotient[used - 1] == 0ull) {
+                used--;
+            }
+        }
+        return;
+    }
+    powers.invert(level);
+    //The value is below P_level ^ 2, so its normalized form is below the square of the normalized divisor.
+    auto& divisor = powers.divisors[level];
+    const size_t n = divisor.size();
+    std::vector<BasicIntegerType::ElementType> dividend(length + 1, 0ull), quotient(n + 1), remainder(n);
+    u64_variable_length_integer_multiply_add_small(dividend.data(), limbs, length + 1, length, 1ull << powers.shifts[level], NativeRadix{});
+    u64_variable_length_integer_reciprocal_division(
+        dividend.data(), u64_variable_length_integer_significant_length(dividend.data(), length + 1), divisor.data(), powers.reciprocals[level].data(),
+        n, quotient.data(), remainder.data(), NativeRadix{}, powers.karatsuba_threshold, powers.ntt_threshold
+    );
+    u64_variable_length_integer_division_by_small(remainder.data(), n, 1ull << powers.shifts[level], NativeRadix{});
+    print_native_decimal_chunks(remainder.data(), n, level - 1, powers, chunks);
+    print_native_decimal_chunks(quotient.data(), n + 1, level - 1, powers, chunks + (count >> 1));
+    return;
+}
+
+void parse_chunks_to_native_limbs(const std::vector<BasicIntegerType::ElementType>& chunks, BasicIntegerType& data) {
+    const size_t len = data.len;
+    auto arr = data.get_ensured_pointer();
+    memset(arr, 0, len * sizeof(BasicIntegerType::ElementType));
+    size_t used = 0;
+    switch (data.iobasic) {
+        case IOBasic::hex: {
+            if (chunks.size() > len) {
+                throw PUTILS_GENERAL_EXCEPTION("Integer length limit exceeded.", "parse error");
+            }
+            std::copy(chunks.begin(), chunks.end(), arr);
+            used = chunks.size();
+            break;
+        }
+        case IOBasic::oct: {
+            for (size_t k = 0; k < chunks.size(); k++) {
+                const size_t position = k * 63, limb = position >> 6, shift = position & 63;
+                const BasicIntegerType::ElementType high = shift > 1 ? chunks[k] >> (64 - shift) : 0ull;
+                if ((limb >= len && chunks[k] != 0ull) || (limb + 1 >= len && high != 0ull)) {
+                    throw PUTILS_GENERAL_EXCEPTION("Integer length limit exceeded.", "parse error");
+                }
+                if (limb < len) {
+                    arr[limb] |= chunks[k] << shift;
+                }
+                if (high != 0ull) {
+                    arr[limb + 1] |= high;
+                }
+            }
+            used = std::min<size_t>(((chunks.size() * 63) >> 6) + 1, len);
+            break;
+        }
+        default: {
+            if (chunks.empty()) {
+                break;
+            }
+            NativeDecimalPowers powers;
+            std::vector<BasicIntegerType::ElementType> limbs(chunks.size());
+            parse_native_decimal_chunks(chunks.data(), chunks.size(), powers, limbs.data());
+            used = u64_variable_length_integer_significant_length(limbs.data(), limbs.size());
+            if (used > len) {
+                throw PUTILS_GENERAL_EXCEPTION("Integer length limit exceeded.", "parse error");
+            }
+            std::copy(limbs.begin(), limbs.begin() + used, arr);
+        }
+    }
+    data.used_len = u64_variable_length_integer_significant_length(arr, used);
+    return;
+}
+
+std::vector<BasicIntegerType::ElementType> parse_native_limbs_to_chunks(const BasicIntegerType& data) {
+    const auto arr = data.get_pointer();
+    size_t used = u64_variable_length_integer_significant_length(arr, data.used_len);
+    std::vector<BasicIntegerType::ElementType> chunks;
+    switch (data.iobasic) {
+        case IOBasic::hex: {
+            chunks.assign(arr, arr + used);
+            break;
+        }
+        case IOBasic::oct: {
+            const size_t count = ((used << 6) + 62) / 63;
+            for (size_t k = 0; k < count; k++) {
+                const size_t position = k * 63, limb = position >> 6, shift = position & 63;
+                BasicIntegerType::ElementType chunk = arr[limb] >> shift;
+                if (shift > 1 && limb + 1 < used) {
+                    chunk |= arr[limb + 1] << (64 - shift);
+                }
+                chunks.emplace_back(chunk & ((1ull << 63) - 1));
+            }
+            while (!chunks.empty() && chunks.back() == 0ull) {
+                chunks.pop_back();
+            }
+            break;
+        }
+        default: {
+            if (used == 0) {
+                break;
+            }
+            //The top level is the first one whose square P_(level + 1) exceeds the value.
+            NativeDecimalPowers powers;
+            size_t level = 0;
+            while (true) {
+                while (powers.powers.size() <= level + 1) {
+                    powers.square();
+                }
+                auto& power = powers.powers[level + 1];
+                if (u64_variable_length_integer_compare_unbalanced(arr, used, power.data(), power.size()) < 0) {
+                    break;
+                }
+                level++;
+            }
+            chunks.assign(2ull << level, 0ull);
+            print_native_decimal_chunks(arr, used, level, powers, chunks.data());
+            while (!chunks.empty() && chunks.back() == 0ull) {
+                chunks.pop_back();
+            }
+        }
+    }
+    return chunks;
+}
+
+void parse_string_to_native_integer(const std::string& integer_str, BasicIntegerType& data) {
+    const BasicIntegerType::ElementType io_base = iofun::io_base(data.iobasic);
+    const size_t width = iofun::log_store_base(data.iobasic, StoreRadix::native);
+    std::vector<BasicIntegerType::ElementType> chunks((integer_str.length() + width - 1) / width, 0ull);
+    BasicIntegerType::ElementType power = 1ull;
+    for (size_t i = integer_str.length(), k = 0; i-- > 0; k++) {
+        BasicIntegerType::ElementType digit;
+        try {
+            digit = iofun::digit_parse(integer_str[i]);
+        } PUTILS_CATCH_THROW_GENERAL
+        if (digit >= io_base) {
+            std::stringstream ss;
+            ss << "Invalid digit: '" << integer_str[i] << "' in base: " << iofun::base_name(data.iobasic);
+            throw PUTILS_GENERAL_EXCEPTION(ss.str(), "parse error");
+        }
+        if (k % width == 0) {
+            power = 1ull;
+        }
+        chunks[k / width] += power * digit;
+        power *= io_base;
+    }
+    while (!chunks.empty() && chunks.back() == 0ull) {
+        chunks.pop_back();
+    }
+    try {
+        parse_chunks_to_native_limbs(chunks, data);
+    } PUTILS_CATCH_THROW_GENERAL
+    return;
+}
+
 void parse_string_to_integer(std::string_view integer_view, BasicIntegerType& data) {
     if (integer_view.empty()) {
         throw PUTILS_GENERAL_EXCEPTION("Empty string input.", "parse error");
@@ -150,10 +621,17 @@ void parse_string_to_integer(std::string_view integer_view, BasicIntegerType& da
         data.sign = false;
         integer_str = integer_str.substr(1);
     }
+    if (data.radix == StoreRadix::native) {
+        try {
+            parse_string_to_native_integer(integer_str, data);
+        } PUTILS_CATCH_THROW_GENERAL
+        return;
+    }
     size_t len = data.len;
     auto arr = data.get_ensured_pointer();
     memset(arr, 0, len * sizeof(BasicIntegerType::ElementType));
-    BasicIntegerType::ElementType base = iofun::store_base(data.iobasic);
+    //Compact and wide limbs are both fixed-width chunks of io digits.
+    const BasicIntegerType::ElementType base = iofun::store_base(data.iobasic, data.radix);
     BasicIntegerType::ElementType store_digit = 0ull, power = 1ull;
     int p = 0;
     for (int i = integer_str.length() - 1; i >= 0; i--) {
@@ -168,7 +646,7 @@ void parse_string_to_integer(std::string_view integer_view, BasicIntegerType& da
         }
         store_digit += power * digit;
         power *= iofun::io_base(data.iobasic);
-        if (power == iofun::store_base(data.iobasic)) {
+        if (power == base) {
             if (p >= len) {
                 throw PUTILS_GENERAL_EXCEPTION("Integer length limit exceeded.", "parse error");
             }
@@ -183,26 +661,45 @@ void parse_string_to_integer(std::string_view integer_view, BasicIntegerType& da
             throw PUTILS_GENERAL_EXCEPTION("Integer length limit exceeded.", "parse error");
         }
     }
+    data.used_len = u64_variable_length_integer_significant_length(arr, std::min<size_t>(p + 1, len));
     return;
 }
 
 void parse_integer_to_stream(std::ostream& stream, const BasicIntegerType& data) noexcept {
-    size_t len = data.len;
-    auto arr = data.get_pointer();
-    if (arr == nullptr) {
+    //The limbs from used_len on are zeros, so printing costs O(used_len).
+    size_t len = std::min<size_t>(data.used_len, data.len);
+    if (data.data == nullptr && data.packed == nullptr) {
         return;
     }
     if (data.sign == false) {
         stream << '-';
     }
+    if (data.radix == StoreRadix::native) {
+        const auto chunks = parse_native_limbs_to_chunks(data);
+        for (size_t k = chunks.size(); k-- > 0; ) {
+            iofun::write_store_digit_to_stream(stream, data.iobasic, chunks[k], k + 1 != chunks.size(), StoreRadix::native);
+        }
+        if (chunks.empty()) {
+            stream << '0';
+        }
+        return;
+    }
+    //A packed integer is printed from its 32-bit limbs directly.
     bool none_zero = false;
-    for (int i = len - 1; i >= 0; i--) {
-        if (arr[i] != 0ull && !none_zero) {
-            none_zero = true;
-            iofun::write_store_digit_to_stream(stream, data.iobasic, arr[i], false);
-        } else if (none_zero) {
-            iofun::write_store_digit_to_stream(stream, data.iobasic, arr[i], true);
+    auto write_limbs = [&](const auto* arr) {
+        for (int i = len - 1; i >= 0; i--) {
+            if (arr[i] != 0ull && !none_zero) {
+                none_zero = true;
+                iofun::write_store_digit_to_stream(stream, data.iobasic, arr[i], false, data.radix);
+            } else if (none_zero) {
+                iofun::write_store_digit_to_stream(stream, data.iobasic, arr[i], true, data.radix);
+            }
         }
+    };
+    if (data.data != nullptr) {
+        write_limbs(data.get_pointer());
+    } else {
+        write_limbs(data.packed->get<uint32_t>());
     }
     if (!none_zero) {
         stream << '0';
@@ -20,14 +20,15 @@ uint64_t digit_parse(const char digit) {
     }
 }
 
-size_t precision_to_log_len(const size_t digits_cnt, const IOBasic iobasic) noexcept {
-    return std::countr_zero(std::bit_ceil((digits_cnt + log_store_base(iobasic) - 1) / log_store_base(iobasic)));
+size_t precision_to_log_len(const size_t digits_cnt, const IOBasic iobasic, const StoreRadix radix) noexcept {
+    const uint64_t digits_per_limb = log_store_base(iobasic, radix);
+    return std::countr_zero(std::bit_ceil((digits_cnt + digits_per_limb - 1) / digits_per_limb));
 }
 
-void write_store_digit_to_stream(std::ostream& stream, const IOBasic iobasic, uint64_t digit, bool filling) noexcept {
+void write_store_digit_to_stream(std::ostream& stream, const IOBasic iobasic, uint64_t digit, bool filling, const StoreRadix radix) noexcept {
     std::ostringstream oss;
     if (filling) {
-        oss << std::setw(log_store_base(iobasic)) << std::setfill('0');
+        oss << std::setw(log_store_base(iobasic, radix)) << std::setfill('0');
     }
     switch(iobasic) {
         case IOBasic::oct: oss << std::oct << digit; break;
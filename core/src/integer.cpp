@@ -18,6 +18,7 @@ struct IntegerDAGContext::Field {
     NodeHandles nodes;
     size_t log_len;
     IOBasic iobasic;
+    StoreRadix radix;
     bool need_update;
 };
 
@@ -32,15 +33,38 @@ struct IntegerVarReference::Field {
 
 bool nodes_topological_sort(IntegerDAGContext::Field::NodeHandles& node_handle_list) noexcept;
 
-IntegerDAGContext::IntegerDAGContext(size_t precesion, IOBasic iobasic) {
+void fit_context(IntegerDAGContext::Field& field, size_t bound) {
+    //Grows the capacity of every integer of the context to hold bound limbs, if auto_growth is enabled.
+    static const bool auto_growth = GlobalConfig::get_global_config().get_or_else<bool>(
+        "Configurations/core/Context/auto_growth", false
+    );
+    static const size_t max_log_length = GlobalConfig::get_global_config().get_or_else<int64_t>(
+        "Configurations/core/BasicIntegerType/limits/max_log_length", 0ll
+    );
+    const size_t log_len = std::min<size_t>(std::countr_zero(std::bit_ceil(std::max<size_t>(bound, 1))), max_log_length);
+    if (!auto_growth || log_len <= field.log_len) {
+        return;
+    }
+    for (auto& node_handle: field.nodes) {
+        if (node_handle->data != nullptr) {
+            try {
+                node_handle->data->resize(log_len);
+            } PUTILS_CATCH_THROW_GENERAL
+        }
+    }
+    field.log_len = log_len;
+    return;
+}
+
+IntegerDAGContext::IntegerDAGContext(size_t precesion, IOBasic iobasic, StoreRadix radix) {
     static const size_t min_log_length = GlobalConfig::get_global_config().get_or_else<int64_t>(
         "Configurations/core/BasicIntegerType/limits/min_log_length", 8ull
     );
     field = std::make_shared<IntegerDAGContext::Field>(
         IntegerDAGContext::Field::Signatures(),
         IntegerDAGContext::Field::NodeHandles(),
-        std::max<size_t>(iofun::precision_to_log_len(precesion, iobasic), min_log_length),
-        iobasic, false
+        std::max<size_t>(iofun::precision_to_log_len(precesion, iobasic, radix), min_log_length),
+        iobasic, radix, false
     );
 }
 
@@ -133,8 +157,64 @@ void IntegerDAGContext::nodes_sort() {
     return;
 }
 
+void IntegerDAGContext::grow_precision() {
+    //The nodes are kept in the order of their construction, so the bounds of the operands are estimated first.
+    size_t bound = 0;
+    for (auto& node_handle: field->nodes) {
+        node_handle->estimate_bound();
+        bound = std::max<size_t>(bound, node_handle->bound);
+    }
+    try {
+        fit_context(*field, bound);
+    } PUTILS_CATCH_THROW_GENERAL
+    return;
+}
+
+void IntegerDAGContext::fuse_multiply_add() {
+    //Rewrites D = A * B +- C into a fused node, when the product is consumed by the addition only and not referenced.
+    static const size_t fused_threshold = std::max<int64_t>(GlobalConfig::get_global_config().get_or_else<int64_t>(
+        "Configurations/core/Multiplication/fused_threshold", 1024ll
+    ), 0ll);
+    std::unordered_map<BasicNodeType*, std::vector<IntegerVarReference*>> referenced;
+    std::unordered_map<BasicNodeType*, Field::NodeHandles::iterator> positions;
+    for (auto var_ref_ptr: field->signatures) {
+        referenced[var_ref_ptr->field->node.get()].emplace_back(var_ref_ptr);
+    }
+    for (auto it = field->nodes.begin(); it != field->nodes.end(); it++) {
+        positions[it->get()] = it;
+    }
+    for (auto it = field->nodes.begin(); it != field->nodes.end(); it++) {
+        auto node_add = dynamic_cast<ArithmeticAddNodeForInteger*>(it->get());
+        //The fused node runs a single task, so the sum is expected to take its bound rather than the capacity.
+        if (node_add == nullptr || std::min<size_t>(node_add->data->len, node_add->bound) >= fused_threshold) {
+            continue;
+        }
+        for (auto operand: {node_add->operand_B, node_add->operand_A}) {
+            auto node_mul = dynamic_cast<ArithmeticMulNodeForInteger*>(operand);
+            if (node_mul == nullptr || node_mul->nexts.size() != 1 || referenced.contains(node_mul)) {
+                continue;
+            }
+            auto node_fused = std::make_shared<ArithmeticMulAddNodeForInteger>(*node_add, *node_mul);
+            auto ref_it = referenced.find(node_add);
+            if (ref_it != referenced.end()) {
+                for (auto var_ref_ptr: ref_it->second) {
+                    var_ref_ptr->field->node = node_fused;
+                }
+            }
+            //The product precedes the addition, so erasing it keeps the iterator valid.
+            field->nodes.erase(positions[node_mul]);
+            positions.erase(node_mul);
+            *it = node_fused;
+            break;
+        }
+    }
+    return;
+}
+
 void IntegerDAGContext::generate_procedures() {
     std::unordered_map<uintptr_t, bool> data_keep_flag;
+    grow_precision();
+    fuse_multiply_add();
     for (auto& node_handle: field->nodes) {
         try {
             data_keep_flag[reinterpret_cast<uintptr_t>(node_handle.get())] = false;
@@ -185,6 +265,8 @@ void IntegerDAGContext::clean_up() {
             throw PUTILS_GENERAL_EXCEPTION("Missing data field of a referenced node!", "post-processing error");
         }
         auto new_node = std::make_shared<ConstantNode>(*(var_ref_ptr->field->node));
+        //The integers at rest hold 32-bit limbs with packed_limbs.
+        new_node->data->pack();
         var_ref_ptr->field->node = new_node;
         new_nodes.push_back(new_node);
     }
@@ -206,7 +288,10 @@ void IntegerDAGContext::update() {
 
 IntegerVarReference::IntegerVarReference(const char* integer_str, IntegerDAGContext& context) {
     std::string_view integer_view(integer_str);
-    auto node = std::make_shared<ConstantNode>(context.field->log_len, context.field->iobasic);
+    try {
+        fit_context(*context.field, 1ull << iofun::precision_to_log_len(integer_view.length(), context.field->iobasic, context.field->radix));
+    } PUTILS_CATCH_THROW_GENERAL
+    auto node = std::make_shared<ConstantNode>(context.field->log_len, context.field->iobasic, context.field->radix);
     auto it = context.field->signatures.emplace(context.field->signatures.end(), this);
     context.field->nodes.emplace_back(node);
     field = std::make_unique<IntegerVarReference::Field>(context.field, node, it);
@@ -217,7 +302,10 @@ IntegerVarReference::IntegerVarReference(const char* integer_str, IntegerDAGCont
 
 IntegerVarReference::IntegerVarReference(const char* integer_str, IntegerDAGContext&& context) {
     std::string_view integer_view(integer_str);
-    auto node = std::make_shared<ConstantNode>(context.field->log_len, context.field->iobasic);
+    try {
+        fit_context(*context.field, 1ull << iofun::precision_to_log_len(integer_view.length(), context.field->iobasic, context.field->radix));
+    } PUTILS_CATCH_THROW_GENERAL
+    auto node = std::make_shared<ConstantNode>(context.field->log_len, context.field->iobasic, context.field->radix);
     auto it = context.field->signatures.emplace(context.field->signatures.end(), this);
     context.field->nodes.emplace_back(node);
     field = std::make_unique<IntegerVarReference::Field>(context.field, node, it);
@@ -580,4 +668,419 @@ IntegerVarReference operator + (IntegerVarReference& integer_A, IntegerVarRefere
     return integer_result;
 }
 
+IntegerVarReference operator - (IntegerVarReference& integer_A, IntegerVarReference& integer_B) {
+    if (integer_A.field->context != integer_B.field->context) {
+        throw PUTILS_GENERAL_EXCEPTION("Unable to subtract two integers of different contexts!", "arithmetic error");
+    }
+    auto& context_ptr = integer_A.field->context;
+    IntegerVarReference integer_result = integer_A;
+    integer_result.field->node = std::make_shared<ArithmeticAddNodeForInteger>(
+        integer_A.field->node, integer_B.field->node, true
+    );
+    context_ptr->nodes.emplace_back(integer_result.field->node);
+    context_ptr->need_update = true;
+    return integer_result;
+}
+
+IntegerVarReference operator - (IntegerVarReference& integer) {
+    //The negation shares the limbs of the operand and only flips its sign.
+    auto& context_ptr = integer.field->context;
+    IntegerVarReference integer_result = integer;
+    integer_result.field->node = std::make_shared<ArithmeticNegNodeForInteger>(integer.field->node);
+    context_ptr->nodes.emplace_back(integer_result.field->node);
+    context_ptr->need_update = true;
+    return integer_result;
+}
+
+IntegerVarReference operator * (IntegerVarReference& integer_A, IntegerVarReference& integer_B) {
+    if (integer_A.field->context != integer_B.field->context) {
+        throw PUTILS_GENERAL_EXCEPTION("Unable to multiply two integers of different contexts!", "arithmetic error");
+    }
+    auto& context_ptr = integer_A.field->context;
+    IntegerVarReference integer_result = integer_A;
+    integer_result.field->node = std::make_shared<ArithmeticMulNodeForInteger>(
+        integer_A.field->node, integer_B.field->node
+    );
+    context_ptr->nodes.emplace_back(integer_result.field->node);
+    context_ptr->need_update = true;
+    return integer_result;
+}
+
+IntegerVarReference operator / (IntegerVarReference& integer_A, IntegerVarReference& integer_B) {
+    if (integer_A.field->context != integer_B.field->context) {
+        throw PUTILS_GENERAL_EXCEPTION("Unable to divide two integers of different contexts!", "arithmetic error");
+    }
+    auto& context_ptr = integer_A.field->context;
+    IntegerVarReference integer_result = integer_A;
+    integer_result.field->node = std::make_shared<ArithmeticDivNodeForInteger>(
+        integer_A.field->node, integer_B.field->node, ArithmeticDivNodeForInteger::Output::quotient
+    );
+    context_ptr->nodes.emplace_back(integer_result.field->node);
+    context_ptr->need_update = true;
+    return integer_result;
+}
+
+IntegerVarReference operator % (IntegerVarReference& integer_A, IntegerVarReference& integer_B) {
+    if (integer_A.field->context != integer_B.field->context) {
+        throw PUTILS_GENERAL_EXCEPTION("Unable to divide two integers of different contexts!", "arithmetic error");
+    }
+    auto& context_ptr = integer_A.field->context;
+    IntegerVarReference integer_result = integer_A;
+    integer_result.field->node = std::make_shared<ArithmeticDivNodeForInteger>(
+        integer_A.field->node, integer_B.field->node, ArithmeticDivNodeForInteger::Output::remainder
+    );
+    context_ptr->nodes.emplace_back(integer_result.field->node);
+    context_ptr->need_update = true;
+    return integer_result;
+}
+
+IntegerVarReference operator * (IntegerVarReference& integer, uint64_t scalar) {
+    //The word is kept by the node itself instead of a constant node of the context.
+    auto& context_ptr = integer.field->context;
+    IntegerVarReference integer_result = integer;
+    integer_result.field->node = std::make_shared<ArithmeticScalarNodeForInteger>(
+        integer.field->node, ArithmeticScalarNodeForInteger::Operation::multiply, scalar
+    );
+    context_ptr->nodes.emplace_back(integer_result.field->node);
+    context_ptr->need_update = true;
+    return integer_result;
+}
+
+IntegerVarReference operator * (uint64_t scalar, IntegerVarReference& integer) {
+    return integer * scalar;
+}
+
+IntegerVarReference operator / (IntegerVarReference& integer, uint64_t scalar) {
+    auto& context_ptr = integer.field->context;
+    IntegerVarReference integer_result = integer;
+    integer_result.field->node = std::make_shared<ArithmeticScalarNodeForInteger>(
+        integer.field->node, ArithmeticScalarNodeForInteger::Operation::divide, scalar
+    );
+    context_ptr->nodes.emplace_back(integer_result.field->node);
+    context_ptr->need_update = true;
+    return integer_result;
+}
+
+IntegerVarReference operator % (IntegerVarReference& integer, uint64_t scalar) {
+    auto& context_ptr = integer.field->context;
+    IntegerVarReference integer_result = integer;
+    integer_result.field->node = std::make_shared<ArithmeticScalarNodeForInteger>(
+        integer.field->node, ArithmeticScalarNodeForInteger::Operation::modulo, scalar
+    );
+    context_ptr->nodes.emplace_back(integer_result.field->node);
+    context_ptr->need_update = true;
+    return integer_result;
+}
+
+IntegerVarReference operator << (IntegerVarReference& integer, size_t bits) {
+    //Returns A * 2 ^ bits, keeping the sign of A.
+    auto& context_ptr = integer.field->context;
+    IntegerVarReference integer_result = integer;
+    integer_result.field->node = std::make_shared<ArithmeticShiftNodeForInteger>(
+        integer.field->node, ArithmeticShiftNodeForInteger::Direction::left, ArithmeticShiftNodeForInteger::Unit::bit, bits
+    );
+    context_ptr->nodes.emplace_back(integer_result.field->node);
+    context_ptr->need_update = true;
+    return integer_result;
+}
+
+IntegerVarReference operator >> (IntegerVarReference& integer, size_t bits) {
+    //Returns The quotient A / 2 ^ bits truncated toward zero, keeping the sign of A.
+    auto& context_ptr = integer.field->context;
+    IntegerVarReference integer_result = integer;
+    integer_result.field->node = std::make_shared<ArithmeticShiftNodeForInteger>(
+        integer.field->node, ArithmeticShiftNodeForInteger::Direction::right, ArithmeticShiftNodeForInteger::Unit::bit, bits
+    );
+    context_ptr->nodes.emplace_back(integer_result.field->node);
+    context_ptr->need_update = true;
+    return integer_result;
+}
+
+IntegerVarReference sum(const std::vector<IntegerVarReference>& integers) {
+    //Returns the sum of all the integers, which must share one context.
+    if (integers.empty()) {
+        throw PUTILS_GENERAL_EXCEPTION("Unable to sum an empty list of integers!", "arithmetic error");
+    }
+    auto& context_ptr = integers.front().field->context;
+    std::vector<std::shared_ptr<BasicNodeType>> nodes;
+    for (auto& integer: integers) {
+        if (integer.field->context != context_ptr) {
+            throw PUTILS_GENERAL_EXCEPTION("Unable to sum integers of different contexts!", "arithmetic error");
+        }
+        nodes.emplace_back(integer.field->node);
+    }
+    IntegerVarReference integer_result = integers.front();
+    integer_result.field->node = std::make_shared<ArithmeticSumNodeForInteger>(nodes);
+    context_ptr->nodes.emplace_back(integer_result.field->node);
+    context_ptr->need_update = true;
+    return integer_result;
+}
+
+IntegerVarReference digit_shift_left(IntegerVarReference& integer, size_t digits) {
+    //Returns A * io_base ^ digits, appending digits zeros to the printed integer.
+    auto& context_ptr = integer.field->context;
+    IntegerVarReference integer_result = integer;
+    integer_result.field->node = std::make_shared<ArithmeticShiftNodeForInteger>(
+        integer.field->node, ArithmeticShiftNodeForInteger::Direction::left, ArithmeticShiftNodeForInteger::Unit::digit, digits
+    );
+    context_ptr->nodes.emplace_back(integer_result.field->node);
+    context_ptr->need_update = true;
+    return integer_result;
+}
+
+IntegerVarReference digit_shift_right(IntegerVarReference& integer, size_t digits) {
+    //Returns The quotient A / io_base ^ digits truncated toward zero, dropping the last digits of the printed integer.
+    auto& context_ptr = integer.field->context;
+    IntegerVarReference integer_result = integer;
+    integer_result.field->node = std::make_shared<ArithmeticShiftNodeForInteger>(
+        integer.field->node, ArithmeticShiftNodeForInteger::Direction::right, ArithmeticShiftNodeForInteger::Unit::digit, digits
+    );
+    context_ptr->nodes.emplace_back(integer_result.field->node);
+    context_ptr->need_update = true;
+    return integer_result;
+}
+
+std::pair<IntegerVarReference, IntegerVarReference> isqrt(IntegerVarReference& integer) {
+    //Returns the root floor(sqrt(A)) and the remainder A - root ^ 2.
+    auto& context_ptr = integer.field->context;
+    IntegerVarReference integer_root = integer;
+    integer_root.field->node = std::make_shared<ArithmeticSqrtNodeForInteger>(
+        integer.field->node, ArithmeticSqrtNodeForInteger::Output::root
+    );
+    context_ptr->nodes.emplace_back(integer_root.field->node);
+    IntegerVarReference integer_remainder = integer;
+    integer_remainder.field->node = std::make_shared<ArithmeticSqrtNodeForInteger>(
+        integer.field->node, ArithmeticSqrtNodeForInteger::Output::remainder
+    );
+    context_ptr->nodes.emplace_back(integer_remainder.field->node);
+    context_ptr->need_update = true;
+    return std::make_pair(std::move(integer_root), std::move(integer_remainder));
+}
+
+IntegerVarReference powmod(IntegerVarReference& integer_A, IntegerVarReference& integer_B, IntegerVarReference& integer_M) {
+    //Returns A ^ B mod |M| in [0, |M|).
+    if (integer_A.field->context != integer_B.field->context || integer_A.field->context != integer_M.field->context) {
+        throw PUTILS_GENERAL_EXCEPTION("Unable to exponentiate integers of different contexts!", "arithmetic error");
+    }
+    auto& context_ptr = integer_A.field->context;
+    IntegerVarReference integer_result = integer_A;
+    integer_result.field->node = std::make_shared<ArithmeticPowModNodeForInteger>(
+        integer_A.field->node, integer_B.field->node, integer_M.field->node
+    );
+    context_ptr->nodes.emplace_back(integer_result.field->node);
+    context_ptr->need_update = true;
+    return integer_result;
+}
+
+IntegerVarReference gcd(IntegerVarReference& integer_A, IntegerVarReference& integer_B) {
+    //Returns gcd(|A|, |B|), which is zero only if both are.
+    if (integer_A.field->context != integer_B.field->context) {
+        throw PUTILS_GENERAL_EXCEPTION("Unable to take the gcd of two integers of different contexts!", "arithmetic error");
+    }
+    auto& context_ptr = integer_A.field->context;
+    IntegerVarReference integer_result = integer_A;
+    integer_result.field->node = std::make_shared<ArithmeticGcdNodeForInteger>(
+        integer_A.field->node, integer_B.field->node, ArithmeticGcdNodeForInteger::Output::gcd
+    );
+    context_ptr->nodes.emplace_back(integer_result.field->node);
+    context_ptr->need_update = true;
+    return integer_result;
+}
+
+std::tuple<IntegerVarReference, IntegerVarReference, IntegerVarReference> gcdext(IntegerVarReference& integer_A, IntegerVarReference& integer_B) {
+    //Returns G = gcd(|A|, |B|) and the cofactors S, T with S * A + T * B = G.
+    if (integer_A.field->context != integer_B.field->context) {
+        throw PUTILS_GENERAL_EXCEPTION("Unable to take the gcd of two integers of different contexts!", "arithmetic error");
+    }
+    auto& context_ptr = integer_A.field->context;
+    auto make_output = [&](ArithmeticGcdNodeForInteger::Output output) {
+        IntegerVarReference integer_result = integer_A;
+        integer_result.field->node = std::make_shared<ArithmeticGcdNodeForInteger>(integer_A.field->node, integer_B.field->node, output);
+        context_ptr->nodes.emplace_back(integer_result.field->node);
+        return integer_result;
+    };
+    IntegerVarReference integer_gcd = make_output(ArithmeticGcdNodeForInteger::Output::gcd);
+    IntegerVarReference integer_S = make_output(ArithmeticGcdNodeForInteger::Output::cofactor_A);
+    IntegerVarReference integer_T = make_output(ArithmeticGcdNodeForInteger::Output::cofactor_B);
+    context_ptr->need_update = true;
+    return std::make_tuple(std::move(integer_gcd), std::move(integer_S), std::move(integer_T));
+}
+
+IntegerVarReference cmp(IntegerVarReference& integer_A, IntegerVarReference& integer_B) {
+    //Returns -1, 0 or 1 as A is less than, equal to or greater than B.
+    if (integer_A.field->context != integer_B.field->context) {
+        throw PUTILS_GENERAL_EXCEPTION("Unable to compare two integers of different contexts!", "arithmetic error");
+    }
+    auto& context_ptr = integer_A.field->context;
+    IntegerVarReference integer_result = integer_A;
+    integer_result.field->node = std::make_shared<ArithmeticCompareNodeForInteger>(
+        integer_A.field->node, integer_B.field->node, ArithmeticCompareNodeForInteger::Relation::compare
+    );
+    context_ptr->nodes.emplace_back(integer_result.field->node);
+    context_ptr->need_update = true;
+    return integer_result;
+}
+
+IntegerVarReference operator < (IntegerVarReference& integer_A, IntegerVarReference& integer_B) {
+    //Returns 1 if A < B, 0 otherwise.
+    if (integer_A.field->context != integer_B.field->context) {
+        throw PUTILS_GENERAL_EXCEPTION("Unable to compare two integers of different contexts!", "arithmetic error");
+    }
+    auto& context_ptr = integer_A.field->context;
+    IntegerVarReference integer_result = integer_A;
+    integer_result.field->node = std::make_shared<ArithmeticCompareNodeForInteger>(
+        integer_A.field->node, integer_B.field->node, ArithmeticCompareNodeForInteger::Relation::less
+    );
+    context_ptr->nodes.emplace_back(integer_result.field->node);
+    context_ptr->need_update = true;
+    return integer_result;
+}
+
+IntegerVarReference operator == (IntegerVarReference& integer_A, IntegerVarReference& integer_B) {
+    //Returns 1 if A == B, 0 otherwise.
+    if (integer_A.field->context != integer_B.field->context) {
+        throw PUTILS_GENERAL_EXCEPTION("Unable to compare two integers of different contexts!", "arithmetic error");
+    }
+    auto& context_ptr = integer_A.field->context;
+    IntegerVarReference integer_result = integer_A;
+    integer_result.field->node = std::make_shared<ArithmeticCompareNodeForInteger>(
+        integer_A.field->node, integer_B.field->node, ArithmeticCompareNodeForInteger::Relation::equal
+    );
+    context_ptr->nodes.emplace_back(integer_result.field->node);
+    context_ptr->need_update = true;
+    return integer_result;
+}
+
+IntegerVarReference select(IntegerVarReference& integer_P, IntegerVarReference& integer_A, IntegerVarReference& integer_B) {
+    //Returns A if P is nonzero, B otherwise, sharing the limbs of the selected one.
+    if (integer_P.field->context != integer_A.field->context || integer_P.field->context != integer_B.field->context) {
+        throw PUTILS_GENERAL_EXCEPTION("Unable to select between integers of different contexts!", "arithmetic error");
+    }
+    auto& context_ptr = integer_P.field->context;
+    IntegerVarReference integer_result = integer_A;
+    integer_result.field->node = std::make_shared<ArithmeticSelectNodeForInteger>(
+        integer_P.field->node, integer_A.field->node, integer_B.field->node
+    );
+    context_ptr->nodes.emplace_back(integer_result.field->node);
+    context_ptr->need_update = true;
+    return integer_result;
+}
+
+struct SeriesSplit {
+    IntegerVarReference P, Q, T;
+};
+
+SeriesSplit split_series(IntegerDAGContext& context, uint64_t begin, uint64_t end, const SeriesGenerator& generator, bool need_P) {
+    //Returns P, Q and T of the terms [begin, end). The rightmost products of P are never read by an ancestor, so
+    //P is left as Q there instead of multiplying the largest operands of every level for nothing.
+    if (end - begin == 1) {
+        SeriesTerm term = generator(context, begin);
+        IntegerVarReference T = term.a * term.p;
+        return SeriesSplit{term.p, term.q, T};
+    }
+    const uint64_t middle = begin + (end - begin) / 2;
+    SeriesSplit left = split_series(context, begin, middle, generator, true);
+    SeriesSplit right = split_series(context, middle, end, generator, need_P);
+    //T = T_l * Q_r + P_l * T_r, the operands of every level are of similar sizes.
+    IntegerVarReference Q = left.Q * right.Q;
+    IntegerVarReference U = left.T * right.Q, V = left.P * right.T;
+    IntegerVarReference T = U + V;
+    if (!need_P) {
+        return SeriesSplit{Q, Q, T};
+    }
+    IntegerVarReference P = left.P * right.P;
+    return SeriesSplit{P, Q, T};
+}
+
+std::pair<IntegerVarReference, IntegerVarReference> binary_splitting(IntegerDAGContext& context, uint64_t begin, uint64_t end, const SeriesGenerator& generator) {
+    //Returns Q and T of S = T / Q, the tree holds O(end - begin) nodes and is log2(end - begin) products deep.
+    if (begin >= end) {
+        throw PUTILS_GENERAL_EXCEPTION("Unable to split an empty range of series terms!", "arithmetic error");
+    }
+    if (!generator) {
+        throw PUTILS_GENERAL_EXCEPTION("Unable to split a series without a term generator!", "arithmetic error");
+    }
+    SeriesSplit split = split_series(context, begin, end, generator, false);
+    return std::make_pair(std::move(split.Q), std::move(split.T));
+}
+
+IntegerVarReference multiply_tree(std::vector<IntegerVarReference> factors) {
+    //Multiplies adjacent pairs level by level, so the operands of every level are of similar sizes and independent.
+    while (factors.size() > 1) {
+        std::vector<IntegerVarReference> products;
+        products.reserve((factors.size() + 1) / 2);
+        for (size_t i = 0; i + 1 < factors.size(); i += 2) {
+            products.emplace_back(factors[i] * factors[i + 1]);
+        }
+        if (factors.size() % 2 == 1) {
+            products.emplace_back(std::move(factors.back()));
+        }
+        factors = std::move(products);
+    }
+    return std::move(factors.front());
+}
+
+IntegerVarReference product(const std::vector<IntegerVarReference>& integers) {
+    //Returns the product of all the integers, which must share one context, as a balanced tree of products.
+    if (integers.empty()) {
+        throw PUTILS_GENERAL_EXCEPTION("Unable to multiply an empty list of integers!", "arithmetic error");
+    }
+    for (auto& integer: integers) {
+        if (integer.field->context != integers.front().field->context) {
+            throw PUTILS_GENERAL_EXCEPTION("Unable to multiply integers of different contexts!", "arithmetic error");
+        }
+    }
+    return multiply_tree(integers);
+}
+
+IntegerVarReference product(IntegerDAGContext& context, uint64_t begin, uint64_t end) {
+    //Returns begin * (begin + 1) * ... * (end - 1), 1 for an empty range. Consecutive factors are packed into words first,
+    //so the leaves of the tree are scalar products of one limb and the tree is about log2(n) / 64 times narrower.
+    if (begin >= end) {
+        return context.make_integer("1");
+    }
+    if (begin == 0) {
+        return context.make_integer("0");
+    }
+    IntegerVarReference one = context.make_integer("1");
+    std::vector<uint64_t> words(1, 1ull);
+    for (uint64_t i = begin; i < end; i++) {
+        if (words.back() > UINT64_MAX / i) {
+            words.emplace_back(1ull);
+        }
+        words.back() *= i;
+    }
+    std::vector<IntegerVarReference> factors;
+    factors.reserve(words.size());
+    for (uint64_t word: words) {
+        factors.emplace_back(one * word);
+    }
+    return multiply_tree(std::move(factors));
+}
+
+IntegerVarReference factorial(IntegerDAGContext& context, uint64_t n) {
+    //Returns n! = 1 * 2 * ... * n.
+    if (n == UINT64_MAX) {
+        throw PUTILS_GENERAL_EXCEPTION("Unable to take the factorial of an integer beyond every capacity!", "arithmetic error");
+    }
+    return product(context, 1, n + 1);
+}
+
+IntegerVarReference binomial(IntegerDAGContext& context, uint64_t n, uint64_t k) {
+    //Returns C(n, k) = (n - k + 1) * ... * n / k!, 0 for k > n. Both trees are built for min(k, n - k) factors.
+    if (n == UINT64_MAX) {
+        throw PUTILS_GENERAL_EXCEPTION("Unable to take the binomial coefficient of an integer beyond every capacity!", "arithmetic error");
+    }
+    if (k > n) {
+        return context.make_integer("0");
+    }
+    k = std::min<uint64_t>(k, n - k);
+    if (k == 0) {
+        return context.make_integer("1");
+    }
+    IntegerVarReference numerator = product(context, n - k + 1, n + 1);
+    IntegerVarReference denominator = factorial(context, k);
+    return numerator / denominator;
+}
+
 }
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <random>
+#include <chrono>
+#include <sstream>
+
+#include "pmp/integer.h"
+#include "Basics.h"
+
+/**
+ * Helpers shared by the core tests: random operands, string forms of the results,
+ * result checks and the timing of the verified computations.
+ */
+
+inline std::string random_integer(std::mt19937& gen, size_t digits, mpengine::IOBasic iobasic = mpengine::IOBasic::dec) {
+    //A random integer of exactly digits io digits, without leading zeros.
+    const char* alphabet = "0123456789abcdef";
+    std::uniform_int_distribution<uint64_t> udist_digit(0, mpengine::iofun::io_base(iobasic) - 1);
+    std::string result(digits, '0');
+    for (auto& ch: result) {
+        ch = alphabet[udist_digit(gen)];
+    }
+    result.front() = alphabet[1 + udist_digit(gen) % (mpengine::iofun::io_base(iobasic) - 1)];
+    return result;
+}
+
+inline std::string magnitude(const std::string& str) {
+    return str.front() == '-' ? str.substr(1) : str;
+}
+
+inline std::string to_string(const pmp::integer& integer) {
+    std::ostringstream oss;
+    oss << integer;
+    return oss.str();
+}
+
+inline void check(const std::string& result, const std::string& expected) {
+    if (result != expected) {
+        throw PUTILS_GENERAL_EXCEPTION("Result mismatches the expected value!", "test error");
+    }
+    return;
+}
+
+struct Stopwatch {
+    using Clock = std::chrono::high_resolution_clock;
+    Clock::time_point last;
+    Stopwatch(): last(Clock::now()) {}
+    //The time elapsed since the construction or the previous lap, in units of Duration.
+    template<typename Duration = std::chrono::milliseconds>
+    int64_t lap() {
+        const Clock::time_point now = Clock::now();
+        const int64_t elapsed = std::chrono::duration_cast<Duration>(now - last).count();
+        last = now;
+        return elapsed;
+    }
+};
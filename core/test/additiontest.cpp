@@ -0,0 +1,86 @@
+#include "TestUtils.hpp"
+#include "ArithmeticFunctions.hpp"
+
+std::string reference_sum(const std::string& str_A, const std::string& str_B, size_t precision) {
+    //Sum of the magnitudes by the serial kernels, the operands are expected to share the sign.
+    const size_t log_len = mpengine::iofun::precision_to_log_len(precision, mpengine::IOBasic::dec);
+    mpengine::BasicIntegerType X(log_len, mpengine::IOBasic::dec), Y(log_len, mpengine::IOBasic::dec), Z(log_len, mpengine::IOBasic::dec);
+    mpengine::parse_string_to_integer(str_A, X);
+    mpengine::parse_string_to_integer(str_B, Y);
+    mpengine::u64_variable_length_integer_addition_with_carry(
+        X.get_pointer(), Y.get_pointer(), Z.get_ensured_pointer(), X.len, mpengine::iofun::store_base(X.iobasic)
+    );
+    Z.sign = X.sign;
+    std::ostringstream oss;
+    mpengine::parse_integer_to_stream(oss, Z);
+    return oss.str();
+}
+
+std::string dag_sum(const std::string& str_A, const std::string& str_B, size_t precision) {
+    Stopwatch stopwatch;
+    pmp::context context(precision, pmp::io::dec);
+    pmp::integer A(str_A.c_str(), context);
+    pmp::integer B(str_B.c_str(), context);
+    pmp::integer C = A + B;
+    std::ostringstream oss;
+    oss << C;
+    const int64_t elapsed = stopwatch.lap<std::chrono::milliseconds>();
+    std::cout << "Sum of " << str_A.length() << "-digit and " << str_B.length() << "-digit operands in "
+              << elapsed << "ms." << std::endl;
+    return oss.str();
+}
+
+std::string dag_chain(const std::string& str_X, size_t steps) {
+    //A dependent chain of small additions, each one forwards to its successor by the serialize signal.
+    Stopwatch stopwatch;
+    pmp::context context(200, pmp::io::dec);
+    pmp::integer X(str_X.c_str(), context);
+    pmp::integer R("0", context);
+    for (size_t i = 0; i < steps; i++) {
+        R = R + X;
+    }
+    std::ostringstream oss;
+    oss << R;
+    const int64_t elapsed = stopwatch.lap<std::chrono::milliseconds>();
+    std::cout << "Chain of " << steps << " additions in "
+              << elapsed << "ms." << std::endl;
+    return oss.str();
+}
+
+int main() {
+    //Four executors split the operands into four chunks regardless of the hardware concurrency.
+    putils::ThreadPool::set_global_threadpool(4);
+    std::mt19937 gen(20250815);
+    const size_t precision = 8 << 18;
+
+    std::string str_A = random_integer(gen, precision - 8), str_B = random_integer(gen, precision - 8);
+    check(dag_sum(str_A, str_B, precision), reference_sum(str_A, str_B, precision));
+    check(dag_sum("-" + str_A, "-" + str_B, precision), reference_sum("-" + str_A, "-" + str_B, precision));
+
+    //Carries and borrows rippling through every chunk boundary.
+    std::string nines(precision - 8, '9'), power = "1" + std::string(precision - 8, '0');
+    check(dag_sum(nines, "1", precision), power);
+    check(dag_sum("1", nines, precision), power);
+    check(dag_sum(power, "-1", precision), nines);
+    check(dag_sum("-1", power, precision), nines);
+    check(dag_sum("-" + power, "1", precision), "-" + nines);
+
+    //Magnitudes with a long common prefix, and equal magnitudes of opposite signs.
+    std::string str_C = str_A;
+    str_C.back() = str_C.back() == '9' ? '0' : str_C.back() + 1;
+    check(dag_sum(str_C, "-" + str_A, precision), str_C.back() == '0' ? "-9" : "1");
+    check(dag_sum(str_A, "-" + str_A, precision), "0");
+
+    //Operands of half the capacity, only their used limbs (and the one of the carry) are chunked.
+    std::string half_nines(precision >> 1, '9'), half_power = "1" + std::string(precision >> 1, '0');
+    check(dag_sum(half_nines, "1", precision), half_power);
+    check(dag_sum(half_power, "-1", precision), half_nines);
+    check(dag_sum("1", "-" + half_power, precision), "-" + half_nines);
+    check(dag_sum(str_A.substr(0, precision >> 1), str_B.substr(0, precision >> 1), precision),
+          reference_sum(str_A.substr(0, precision >> 1), str_B.substr(0, precision >> 1), precision));
+
+    //Long dependent chains must not run inline all the way down on a single stack.
+    check(dag_chain("12345678901234567890", 20000), "246913578024691357800000");
+    check(dag_chain("99999999999999999999", 50000), "4999999999999999999950000");
+    return 0;
+}
@@ -0,0 +1,86 @@
+#include "TestUtils.hpp"
+
+void verify_division(const std::string& str_A, const std::string& str_B, size_t precision, mpengine::IOBasic iobasic, mpengine::StoreRadix radix) {
+    //Checks A = Q * B + R with |R| < |B|, where R is zero or takes the sign of A.
+    Stopwatch stopwatch;
+    pmp::context context(precision, iobasic, radix);
+    pmp::integer A(str_A.c_str(), context);
+    pmp::integer B(str_B.c_str(), context);
+    pmp::integer Q = A / B;
+    pmp::integer R = A % B;
+    pmp::integer P = Q * B;
+    pmp::integer C = P + R;
+    std::ostringstream oss_Q, oss_R, oss_C;
+    oss_Q << Q;
+    oss_R << R;
+    oss_C << C;
+    const int64_t elapsed = stopwatch.lap<std::chrono::milliseconds>();
+    const std::string str_R = oss_R.str(), str_C = oss_C.str();
+    if (str_C != str_A) {
+        throw PUTILS_GENERAL_EXCEPTION("Quotient and remainder fail to reproduce the dividend!", "test error");
+    }
+    const std::string abs_R = magnitude(str_R), abs_B = magnitude(str_B);
+    if (abs_R.length() > abs_B.length() || (abs_R.length() == abs_B.length() && abs_R >= abs_B)) {
+        throw PUTILS_GENERAL_EXCEPTION("Remainder is not less than the divisor!", "test error");
+    }
+    if (str_R != "0" && (str_R.front() == '-') != (str_A.front() == '-')) {
+        throw PUTILS_GENERAL_EXCEPTION("Remainder does not take the sign of the dividend!", "test error");
+    }
+    std::cout << mpengine::iofun::base_name(iobasic) << " " << mpengine::iofun::radix_name(radix) << " division of "
+              << magnitude(str_A).length() << " by " << abs_B.length() << " digits verified in "
+              << elapsed << "ms." << std::endl;
+    return;
+}
+
+void check(const std::string& str_A, const std::string& str_B, const std::string& expected_Q, const std::string& expected_R) {
+    pmp::context context(1000, pmp::io::dec);
+    pmp::integer A(str_A.c_str(), context);
+    pmp::integer B(str_B.c_str(), context);
+    pmp::integer Q = A / B;
+    pmp::integer R = A % B;
+    std::ostringstream oss_Q, oss_R;
+    oss_Q << Q;
+    oss_R << R;
+    if (oss_Q.str() != expected_Q || oss_R.str() != expected_R) {
+        throw PUTILS_GENERAL_EXCEPTION("Division mismatches the expected quotient and remainder!", "test error");
+    }
+    return;
+}
+
+int main() {
+    //Four executors split the products of the Newton iterations into four chunks.
+    putils::ThreadPool::set_global_threadpool(4);
+    std::mt19937 gen(20250815);
+
+    //Truncation toward zero, zero and trivial cases.
+    check("7", "2", "3", "1");
+    check("-7", "2", "-3", "-1");
+    check("7", "-2", "-3", "1");
+    check("-7", "-2", "3", "-1");
+    check("6", "-3", "-2", "0");
+    check("3", "7", "0", "3");
+    check("-3", "7", "0", "-3");
+    check("12345", "0", "0", "0");
+
+    for (auto radix: {pmp::radix::compact, pmp::radix::native, pmp::radix::wide}) {
+        for (auto iobasic: {mpengine::IOBasic::dec, mpengine::IOBasic::hex}) {
+            //Single-limb divisors, the schoolbook tier and the Newton tier (with quotients longer and shorter than the divisor).
+            for (auto [digits_A, digits_B]: std::initializer_list<std::pair<size_t, size_t>>{
+                {2000, 5}, {2000, 300}, {3000, 2950}, {40000, 15000}, {40000, 2000}, {40000, 39000}, {60000, 30001}
+            }) {
+                const std::string str_A = random_integer(gen, digits_A, iobasic), str_B = random_integer(gen, digits_B, iobasic);
+                verify_division(str_A, str_B, 80000, iobasic, radix);
+                verify_division("-" + str_A, str_B, 80000, iobasic, radix);
+                verify_division(str_A, "-" + str_B, 80000, iobasic, radix);
+            }
+        }
+    }
+
+    //Divisors of leading all-max digits and powers of the base stress the quotient corrections.
+    const std::string nines(20000, '9'), power = "1" + std::string(20000, '0');
+    verify_division(nines + nines, nines, 80000, pmp::io::dec, pmp::radix::compact);
+    verify_division(power + std::string(20000, '0'), power, 80000, pmp::io::dec, pmp::radix::compact);
+    verify_division(nines + nines, power, 80000, pmp::io::dec, pmp::radix::native);
+    verify_division(power + nines, nines, 80000, pmp::io::dec, pmp::radix::native);
+    return 0;
+}
@@ -0,0 +1,90 @@
+#include "TestUtils.hpp"
+
+void verify_gcd(const std::string& str_X, const std::string& str_Y, const std::string& str_G, size_t precision, mpengine::IOBasic iobasic, mpengine::StoreRadix radix) {
+    //Checks that G = gcd(A, B) divides A = X * G and B = Y * G and that S * A + T * B = G, which makes G the greatest one.
+    pmp::context context(precision, iobasic, radix);
+    pmp::integer X(str_X.c_str(), context);
+    pmp::integer Y(str_Y.c_str(), context);
+    pmp::integer G(str_G.c_str(), context);
+    pmp::integer A = X * G;
+    pmp::integer B = Y * G;
+    Stopwatch stopwatch;
+    pmp::integer D = gcd(A, B);
+    const std::string str_D = to_string(D);
+    const int64_t elapsed_gcd = stopwatch.lap<std::chrono::milliseconds>();
+    auto [E, S, T] = gcdext(A, B);
+    pmp::integer SA = S * A;
+    pmp::integer TB = T * B;
+    pmp::integer C = SA + TB;
+    pmp::integer RA = A % D;
+    pmp::integer RB = B % D;
+    const std::string str_E = to_string(E), str_C = to_string(C);
+    const int64_t elapsed_gcdext = stopwatch.lap<std::chrono::milliseconds>();
+    if (str_D != str_E || str_C != str_D) {
+        throw PUTILS_GENERAL_EXCEPTION("Cofactors fail to reproduce the gcd!", "test error");
+    }
+    if (to_string(RA) != "0" || to_string(RB) != "0") {
+        throw PUTILS_GENERAL_EXCEPTION("Gcd does not divide the operands!", "test error");
+    }
+    std::cout << mpengine::iofun::base_name(iobasic) << " " << mpengine::iofun::radix_name(radix) << " gcd of "
+              << str_X.length() + str_G.length() << " and " << str_Y.length() + str_G.length() << " digits verified, gcd in "
+              << elapsed_gcd << "ms, gcdext in " << elapsed_gcdext << "ms." << std::endl;
+    return;
+}
+
+void check(const std::string& str_A, const std::string& str_B, const std::string& expected_G, const std::string& expected_S, const std::string& expected_T, mpengine::StoreRadix radix) {
+    pmp::context context(200, pmp::io::dec, radix);
+    pmp::integer A(str_A.c_str(), context);
+    pmp::integer B(str_B.c_str(), context);
+    auto [G, S, T] = gcdext(A, B);
+    if (to_string(G) != expected_G || to_string(S) != expected_S || to_string(T) != expected_T) {
+        throw PUTILS_GENERAL_EXCEPTION("Extended gcd mismatches the expected cofactors!", "test error");
+    }
+    return;
+}
+
+int main() {
+    putils::ThreadPool::set_global_threadpool(4);
+    std::mt19937 gen(20250815);
+
+    for (auto radix: {pmp::radix::compact, pmp::radix::native, pmp::radix::wide}) {
+        //Signs, zeros and the cofactors of the Euclidean algorithm.
+        check("240", "46", "2", "-9", "47", radix);
+        check("-240", "46", "2", "9", "47", radix);
+        check("240", "-46", "2", "-9", "-47", radix);
+        check("46", "240", "2", "47", "-9", radix);
+        check("12", "0", "12", "1", "0", radix);
+        check("0", "-12", "12", "0", "-1", radix);
+        check("0", "0", "0", "0", "0", radix);
+        check("17", "17", "17", "0", "1", radix);
+
+        for (auto iobasic: {mpengine::IOBasic::oct, mpengine::IOBasic::dec, mpengine::IOBasic::hex}) {
+            //Lehmer steps only, the half-GCD recursion, and operands of very different lengths.
+            for (auto [digits_X, digits_Y, digits_G]: std::initializer_list<std::tuple<size_t, size_t, size_t>>{
+                {30, 25, 3}, {2000, 1990, 1}, {2000, 2000, 600}, {20000, 19990, 5}, {30000, 29000, 4000}, {40000, 300, 20}
+            }) {
+                verify_gcd(
+                    random_integer(gen, digits_X, iobasic), random_integer(gen, digits_Y, iobasic), random_integer(gen, digits_G, iobasic),
+                    3 * (digits_X + digits_G), iobasic, radix
+                );
+            }
+        }
+    }
+
+    //Consecutive Fibonacci numbers take the longest Euclidean sequence, all of whose quotients are 1.
+    std::string fibonacci_a = "1", fibonacci_b = "1";
+    {
+        pmp::context context(4000, pmp::io::dec);
+        pmp::integer F_a("1", context), F_b("1", context);
+        for (int i = 0; i < 5000; i++) {
+            pmp::integer F_c = F_a + F_b;
+            F_a = F_b;
+            F_b = F_c;
+        }
+        fibonacci_a = to_string(F_a);
+        fibonacci_b = to_string(F_b);
+    }
+    verify_gcd(fibonacci_a, fibonacci_b, "1", 4000, pmp::io::dec, pmp::radix::compact);
+    verify_gcd(fibonacci_a, fibonacci_b, "7", 4000, pmp::io::dec, pmp::radix::native);
+    return 0;
+}
@@ -0,0 +1,73 @@
+#include "TestUtils.hpp"
+
+std::vector<std::string> evaluate(const std::string& str_X, const std::string& str_Y, size_t precision, mpengine::IOBasic iobasic, mpengine::StoreRadix radix) {
+    //Products, powers and shifts far beyond the initial precision, over several updates.
+    pmp::context context(precision, iobasic, radix);
+    pmp::integer X(str_X.c_str(), context), Y(str_Y.c_str(), context), N = -X;
+    pmp::integer P = X * Y, S = P + X, F("1", context);
+    for (uint64_t i = 2; i <= 200; i++) {
+        F = F * i;
+    }
+    context.update();
+    pmp::integer Q = P * P, R = Q * Q, L = R << 3000, D = digit_shift_left(N, 700);
+    pmp::integer T = pmp::sum({R, Q, P, N}), U = R - L, V = L / R;
+    std::vector<std::string> results;
+    for (const pmp::integer* I: {&X, &N, &P, &S, &F, &Q, &R, &L, &D, &T, &U, &V}) {
+        results.emplace_back(to_string(*I));
+    }
+    return results;
+}
+
+void verify(std::mt19937& gen, size_t digits, mpengine::IOBasic iobasic, mpengine::StoreRadix radix) {
+    const std::string str_X = random_integer(gen, digits, iobasic), str_Y = "-" + random_integer(gen, digits, iobasic);
+    const std::vector<std::string> large = evaluate(str_X, str_Y, 8 * digits + 5000, iobasic, radix);
+    const std::vector<std::string> growing = evaluate(str_X, str_Y, 1, iobasic, radix);
+    for (size_t i = 0; i < large.size(); i++) {
+        check(growing[i], large[i]);
+    }
+    return;
+}
+
+void benchmark(size_t steps, mpengine::IOBasic iobasic) {
+    //The Fibonacci recurrence in a context starting at the minimal capacity.
+    pmp::context context(1, iobasic);
+    Stopwatch stopwatch;
+    pmp::integer a("0", context), b("1", context);
+    for (size_t i = 2; i <= steps; i++) {
+        pmp::integer c = a + b;
+        a = b;
+        b = c;
+        if (i % 1000 == 0) {
+            context.update();
+        }
+    }
+    const std::string str_b = to_string(b);
+    const int64_t elapsed = stopwatch.lap<std::chrono::microseconds>();
+    std::cout << mpengine::iofun::base_name(iobasic) << " Fibonacci recurrence of " << steps << " steps grown to "
+              << str_b.length() << " digits in " << elapsed << "us." << std::endl;
+    return;
+}
+
+int main() {
+    //Growth is off by default, the key is read once by the first integer constructed.
+    mpengine::GlobalConfig::get_global_config().insert("Configurations/core/Context/auto_growth", true);
+    putils::ThreadPool::set_global_threadpool(4);
+    std::mt19937 gen(20250815);
+
+    for (auto radix: {pmp::radix::compact, pmp::radix::native, pmp::radix::wide}) {
+        //Integers parsed beyond the capacity grow the context at once.
+        pmp::context context(1, pmp::io::dec, radix);
+        const std::string str_A(5000, '9');
+        pmp::integer A(str_A.c_str(), context), B("1", context);
+        pmp::integer C = A + B;
+        check(to_string(C), "1" + std::string(5000, '0'));
+
+        for (auto iobasic: {mpengine::IOBasic::oct, mpengine::IOBasic::dec, mpengine::IOBasic::hex}) {
+            for (size_t digits: {1, 40, 600}) {
+                verify(gen, digits, iobasic, radix);
+            }
+        }
+    }
+    benchmark(20000, mpengine::IOBasic::dec);
+    return 0;
+}
@@ -0,0 +1,101 @@
+#include "TestUtils.hpp"
+
+void verify_muladd(const std::string& str_X, const std::string& str_Y, const std::string& str_C, mpengine::IOBasic iobasic, mpengine::StoreRadix radix, size_t capacity = 0) {
+    //Products going out of scope before the update are fused, referenced products are not.
+    const size_t digits = std::max({str_X.length() + str_Y.length(), str_C.length(), capacity}) + 16;
+    pmp::context context(digits, iobasic, radix);
+    pmp::integer X(str_X.c_str(), context);
+    pmp::integer Y(str_Y.c_str(), context);
+    pmp::integer C(str_C.c_str(), context);
+    pmp::integer P = X * Y;
+    pmp::integer S_ref = C + P, T_ref = P + C, U_ref = C - P, V_ref = P - C;
+    pmp::integer S = C, T = C, U = C, V = C;
+    {
+        pmp::integer Q = X * Y;
+        S = C + Q;
+    }
+    {
+        pmp::integer Q = X * Y;
+        T = Q + C;
+    }
+    {
+        pmp::integer Q = X * Y;
+        U = C - Q;
+    }
+    {
+        pmp::integer Q = X * Y;
+        V = Q - C;
+    }
+    check(to_string(S), to_string(S_ref));
+    check(to_string(T), to_string(T_ref));
+    check(to_string(U), to_string(U_ref));
+    check(to_string(V), to_string(V_ref));
+    return;
+}
+
+void benchmark(std::mt19937& gen, size_t digits, size_t terms) {
+    //Dot products accumulating the terms one by one.
+    pmp::context context(4 * digits, pmp::io::dec);
+    std::vector<pmp::integer> X, Y;
+    for (size_t i = 0; i < terms; i++) {
+        X.emplace_back(random_integer(gen, digits, mpengine::IOBasic::dec).c_str(), context);
+        Y.emplace_back(random_integer(gen, digits, mpengine::IOBasic::dec).c_str(), context);
+    }
+    context.update();
+    Stopwatch stopwatch;
+    pmp::integer F("0", context);
+    for (size_t i = 0; i < terms; i++) {
+        pmp::integer P = X[i] * Y[i];
+        F = F + P;
+    }
+    const std::string str_F = to_string(F);
+    const int64_t elapsed_fused = stopwatch.lap<std::chrono::microseconds>();
+    pmp::integer R("0", context);
+    std::vector<pmp::integer> products;
+    for (size_t i = 0; i < terms; i++) {
+        products.emplace_back(X[i] * Y[i]);
+        R = R + products.back();
+    }
+    const std::string str_R = to_string(R);
+    const int64_t elapsed_separate = stopwatch.lap<std::chrono::microseconds>();
+    check(str_F, str_R);
+    std::cout << "Dot product of " << terms << " terms of " << digits << " digits fused in "
+              << elapsed_fused << "us, separate nodes in " << elapsed_separate << "us." << std::endl;
+    return;
+}
+
+int main() {
+    putils::ThreadPool::set_global_threadpool(4);
+    std::mt19937 gen(20250815);
+
+    for (auto radix: {pmp::radix::compact, pmp::radix::native, pmp::radix::wide}) {
+        //Zero operands, cancellation and every combination of signs.
+        for (auto [str_X, str_Y, str_C]: std::initializer_list<std::tuple<std::string, std::string, std::string>>{
+            {"0", "123", "456"}, {"123", "456", "0"}, {"0", "0", "0"}, {"12", "-12", "144"}, {"-12", "-12", "144"},
+            {"99999999", "99999999", "1"}, {"-99999999", "99999999", "-1"}, {"7", "11", "-76"}, {"-7", "11", "78"}
+        }) {
+            verify_muladd(str_X, str_Y, str_C, pmp::io::dec, radix);
+        }
+        for (auto iobasic: {mpengine::IOBasic::oct, mpengine::IOBasic::dec, mpengine::IOBasic::hex}) {
+            //Schoolbook rows, blocked Karatsuba products and unbalanced operands, against larger and smaller addends.
+            for (auto [digits_X, digits_Y, digits_C]: std::initializer_list<std::tuple<size_t, size_t, size_t>>{
+                {20, 20, 5}, {20, 20, 60}, {300, 280, 580}, {2000, 1900, 300}, {2500, 60, 2600}, {1500, 1500, 3000}
+            }) {
+                const std::string str_X = random_integer(gen, digits_X, iobasic);
+                const std::string str_Y = random_integer(gen, digits_Y, iobasic);
+                const std::string str_C = random_integer(gen, digits_C, iobasic);
+                verify_muladd(str_X, str_Y, str_C, iobasic, radix);
+                verify_muladd("-" + str_X, str_Y, str_C, iobasic, radix);
+                verify_muladd(str_X, str_Y, "-" + str_C, iobasic, radix);
+            }
+        }
+        //Small operands in a wide context are fused by their bounds rather than by the capacity.
+        const std::string str_X = random_integer(gen, 300), str_Y = random_integer(gen, 280), str_C = random_integer(gen, 40);
+        verify_muladd(str_X, str_Y, str_C, pmp::io::dec, radix, 200000);
+        verify_muladd(str_X, "-" + str_Y, str_C, pmp::io::dec, radix, 200000);
+    }
+
+    benchmark(gen, 100, 2000);
+    benchmark(gen, 1000, 200);
+    return 0;
+}
@@ -0,0 +1,76 @@
+#include "TestUtils.hpp"
+#include "ArithmeticFunctions.hpp"
+
+void verify_product(std::mt19937& gen, size_t precision) {
+    //Operands fill half of the context precision, so the product never overflows.
+    std::string str_A = random_integer(gen, precision / 2 - 8);
+    std::string str_B = "-" + random_integer(gen, precision / 2 - 8);
+
+    Stopwatch stopwatch;
+    pmp::context context(precision, pmp::io::dec);
+    pmp::integer A(str_A.c_str(), context);
+    pmp::integer B(str_B.c_str(), context);
+    pmp::integer C = A * B;
+    std::ostringstream oss_dag;
+    oss_dag << C;
+    const int64_t elapsed = stopwatch.lap<std::chrono::milliseconds>();
+
+    //The reference is the schoolbook kernel, which none of the multiplication tiers dispatch to.
+    const size_t log_len = mpengine::iofun::precision_to_log_len(precision, mpengine::IOBasic::dec);
+    mpengine::BasicIntegerType X(log_len, mpengine::IOBasic::dec), Y(log_len, mpengine::IOBasic::dec), Z(log_len + 1, mpengine::IOBasic::dec);
+    mpengine::parse_string_to_integer(str_A, X);
+    mpengine::parse_string_to_integer(str_B, Y);
+    const size_t length = std::max<size_t>(X.used_len, Y.used_len);
+    mpengine::u64_variable_length_integer_multiplication_c_2len_with_carry(
+        X.get_pointer(), Y.get_pointer(), Z.get_ensured_pointer(), length, mpengine::iofun::store_base(X.iobasic)
+    );
+    Z.used_len = length << 1;
+    Z.sign = X.sign == Y.sign;
+    std::ostringstream oss_ref;
+    mpengine::parse_integer_to_stream(oss_ref, Z);
+
+    if (oss_dag.str() != oss_ref.str()) {
+        throw PUTILS_GENERAL_EXCEPTION("DAG product mismatches the schoolbook product!", "test error");
+    }
+    std::cout << "Product of " << str_A.length() << "-digit operands verified in "
+              << elapsed << "ms." << std::endl;
+    return;
+}
+
+void verify_square(std::mt19937& gen, size_t precision, mpengine::StoreRadix radix) {
+    //A * A shares the operand node and takes the squaring kernels, B holds the same value in a node of its own.
+    const std::string str_A = "-" + random_integer(gen, precision / 2 - 8);
+    pmp::context context(precision, pmp::io::dec, radix);
+    pmp::integer A(str_A.c_str(), context);
+    pmp::integer B(str_A.c_str(), context);
+    Stopwatch stopwatch;
+    pmp::integer S = A * A;
+    std::ostringstream oss_square;
+    oss_square << S;
+    const int64_t elapsed = stopwatch.lap<std::chrono::milliseconds>();
+    pmp::integer P = A * B;
+    std::ostringstream oss_product;
+    oss_product << P;
+    if (oss_square.str() != oss_product.str() || oss_square.str().front() == '-') {
+        throw PUTILS_GENERAL_EXCEPTION("DAG square mismatches the general product!", "test error");
+    }
+    std::cout << "Square of " << str_A.length() - 1 << "-digit operand (" << mpengine::iofun::radix_name(radix) << ") verified in "
+              << elapsed << "ms." << std::endl;
+    return;
+}
+
+int main() {
+    std::mt19937 gen(20250815);
+    //Serial Karatsuba, parallel Karatsuba, Toom-3, Toom-4 and NTT tiers with the default thresholds.
+    verify_product(gen, 1000);
+    verify_product(gen, 4096);
+    verify_product(gen, 8192);
+    verify_product(gen, 16384);
+    verify_product(gen, 131072);
+    for (auto radix: {mpengine::StoreRadix::compact, mpengine::StoreRadix::native}) {
+        for (size_t precision: {40, 1000, 4096, 8192, 16384, 131072}) {
+            verify_square(gen, precision, radix);
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,73 @@
+#include "TestUtils.hpp"
+
+void verify(std::mt19937& gen, size_t digits, mpengine::IOBasic iobasic, mpengine::StoreRadix radix) {
+    //Integers at rest between updates are packed, the next updates consume them again.
+    const std::string str_A = random_integer(gen, digits, iobasic), str_B = random_integer(gen, digits / 3 + 1, iobasic);
+    pmp::context context(3 * digits + 64, iobasic, radix);
+    pmp::integer A(str_A.c_str(), context), B(("-" + str_B).c_str(), context), Z("0", context);
+    pmp::integer N = -A, P = A * B;
+    context.update();
+    check(to_string(A), str_A);
+    check(to_string(N), "-" + str_A);
+    pmp::integer Q = P / B, R = P % A, S = N + A, T = Z * A;
+    context.update();
+    check(to_string(Q), str_A);
+    check(to_string(R), "0");
+    check(to_string(S), "0");
+    check(to_string(T), "0");
+    pmp::integer U = Q - N, V = U - A;
+    check(to_string(V), str_A);
+    check(to_string(B), "-" + str_B);
+    //A packed integer consumed by many tasks at once is widened by only one of them.
+    std::vector<pmp::integer> W;
+    for (size_t i = 0; i < 16; i++) {
+        W.emplace_back(A - V);
+    }
+    context.update();
+    for (const auto& integer: W) {
+        check(to_string(integer), "0");
+    }
+    return;
+}
+
+void benchmark(size_t digits, size_t count, mpengine::IOBasic iobasic) {
+    //Many integers held across updates, then printed.
+    std::mt19937 gen(20250815);
+    pmp::context context(digits, iobasic);
+    std::vector<pmp::integer> integers;
+    for (size_t i = 0; i < count; i++) {
+        integers.emplace_back(random_integer(gen, digits / 2, iobasic).c_str(), context);
+    }
+    Stopwatch stopwatch;
+    for (size_t i = 1; i < count; i++) {
+        integers[i] = integers[i] + integers[i - 1];
+    }
+    context.update();
+    size_t length = 0;
+    for (const auto& integer: integers) {
+        length += to_string(integer).length();
+    }
+    const int64_t elapsed = stopwatch.lap<std::chrono::microseconds>();
+    putils::MemoryPool::MemView view = putils::MemoryPool::get_global_memorypool().report();
+    std::cout << mpengine::iofun::base_name(iobasic) << " " << count << " packed integers of " << length / count << " digits in "
+              << elapsed << "us, "
+              << view.bytes_in_use << " bytes in use." << std::endl;
+    return;
+}
+
+int main() {
+    //Packing is off by default, the key is read once by the first update.
+    mpengine::GlobalConfig::get_global_config().insert("Configurations/core/MemoryPreference/packed_limbs", true);
+    putils::ThreadPool::set_global_threadpool(4);
+    std::mt19937 gen(20250815);
+
+    for (auto radix: {pmp::radix::compact, pmp::radix::native, pmp::radix::wide}) {
+        for (auto iobasic: {mpengine::IOBasic::oct, mpengine::IOBasic::dec, mpengine::IOBasic::hex}) {
+            for (size_t digits: {1, 30, 700, 5000}) {
+                verify(gen, digits, iobasic, radix);
+            }
+        }
+    }
+    benchmark(20000, 200, mpengine::IOBasic::dec);
+    return 0;
+}
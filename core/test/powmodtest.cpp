@@ -0,0 +1,105 @@
+#include "TestUtils.hpp"
+
+void verify_split_exponent(std::mt19937& gen, size_t digits, bool odd, mpengine::IOBasic iobasic, mpengine::StoreRadix radix) {
+    //Checks A ^ (E1 + E2) = (A ^ E1 mod M) * (A ^ E2 mod M) mod M, for exponents of an eighth of the modulus.
+    const std::string alphabet = "0123456789abcdef";
+    std::string str_M = random_integer(gen, digits, iobasic);
+    str_M.back() = alphabet[(alphabet.find(str_M.back()) & ~static_cast<size_t>(1)) | (odd ? 1 : 0)];
+    Stopwatch stopwatch;
+    pmp::context context(4 * digits + 64, iobasic, radix);
+    pmp::integer A(random_integer(gen, digits + 7, iobasic).c_str(), context);
+    pmp::integer E1(random_integer(gen, digits / 8, iobasic).c_str(), context);
+    pmp::integer E2(random_integer(gen, digits / 16 + 1, iobasic).c_str(), context);
+    pmp::integer M(str_M.c_str(), context);
+    pmp::integer E = E1 + E2;
+    pmp::integer P = powmod(A, E, M);
+    pmp::integer P1 = powmod(A, E1, M);
+    pmp::integer P2 = powmod(A, E2, M);
+    pmp::integer Q = P1 * P2;
+    pmp::integer R = Q % M;
+    const std::string str_P = to_string(P), str_R = to_string(R);
+    const int64_t elapsed = stopwatch.lap<std::chrono::milliseconds>();
+    if (str_P != str_R) {
+        throw PUTILS_GENERAL_EXCEPTION("Modular exponentiation mismatches the product of its split exponents!", "test error");
+    }
+    std::cout << mpengine::iofun::base_name(iobasic) << " " << mpengine::iofun::radix_name(radix) << " powmod over "
+              << digits << " digits (" << (odd ? "odd" : "even") << " modulus) verified in "
+              << elapsed << "ms." << std::endl;
+    return;
+}
+
+void verify_square_and_multiply(std::mt19937_64& gen, size_t digits, mpengine::IOBasic iobasic, mpengine::StoreRadix radix) {
+    //Checks against the binary powering by the multiplication and remainder nodes for a 64-bit exponent.
+    std::mt19937 gen_digits(static_cast<uint32_t>(gen()));
+    const uint64_t exponent = gen();
+    pmp::context context(2 * digits + 64, iobasic, radix);
+    pmp::integer A(random_integer(gen_digits, digits, iobasic).c_str(), context);
+    pmp::integer M(random_integer(gen_digits, digits, iobasic).c_str(), context);
+    pmp::integer X("1", context);
+    for (int i = 63; i >= 0; i--) {
+        pmp::integer S = X * X;
+        X = S % M;
+        if ((exponent >> i) & 1ull) {
+            pmp::integer T = X * A;
+            X = T % M;
+        }
+    }
+    const char* alphabet = "0123456789abcdef";
+    const uint64_t io_base = mpengine::iofun::io_base(iobasic);
+    std::string str_E;
+    for (uint64_t rest = exponent; rest != 0; rest /= io_base) {
+        str_E.insert(str_E.begin(), alphabet[rest % io_base]);
+    }
+    pmp::integer E(str_E.c_str(), context);
+    pmp::integer P = powmod(A, E, M);
+    if (to_string(P) != to_string(X)) {
+        throw PUTILS_GENERAL_EXCEPTION("Modular exponentiation mismatches the binary powering!", "test error");
+    }
+    return;
+}
+
+void check(const std::string& str_A, const std::string& str_E, const std::string& str_M, const std::string& expected, mpengine::IOBasic iobasic, mpengine::StoreRadix radix) {
+    pmp::context context(200, iobasic, radix);
+    pmp::integer A(str_A.c_str(), context);
+    pmp::integer E(str_E.c_str(), context);
+    pmp::integer M(str_M.c_str(), context);
+    pmp::integer P = powmod(A, E, M);
+    if (to_string(P) != expected) {
+        throw PUTILS_GENERAL_EXCEPTION("Modular exponentiation mismatches the expected residue!", "test error");
+    }
+    return;
+}
+
+int main() {
+    putils::ThreadPool::set_global_threadpool(4);
+    std::mt19937 gen(20250815);
+    std::mt19937_64 gen_64(20250815);
+
+    for (auto radix: {pmp::radix::compact, pmp::radix::native, pmp::radix::wide}) {
+        //Small residues, negative bases, zero exponents and moduli, and the trivial modulus.
+        check("4", "13", "497", "445", pmp::io::dec, radix);
+        check("-2", "3", "5", "2", pmp::io::dec, radix);
+        check("2", "10", "-1000", "24", pmp::io::dec, radix);
+        check("12345", "0", "7", "1", pmp::io::dec, radix);
+        check("12345", "0", "1", "0", pmp::io::dec, radix);
+        check("12345", "3", "0", "0", pmp::io::dec, radix);
+        check("12345", "-3", "7", "0", pmp::io::dec, radix);
+        check("3", "ff", "10001", "5e", pmp::io::hex, radix);
+        check("-3", "10", "fffffffffffffffffffffffffffffff1", "290d741", pmp::io::hex, radix);
+
+        for (auto iobasic: {mpengine::IOBasic::dec, mpengine::IOBasic::hex}) {
+            for (size_t digits: {5, 40, 300}) {
+                verify_square_and_multiply(gen_64, digits, iobasic, radix);
+            }
+            //2k to 8k-bit operands, odd moduli take the Montgomery path of the binary radices.
+            for (size_t bits: {2048, 4096, 8192}) {
+                const size_t digits = iobasic == mpengine::IOBasic::hex ? bits / 4 : bits * 30103 / 100000;
+                verify_split_exponent(gen, digits, true, iobasic, radix);
+                verify_split_exponent(gen, digits, false, iobasic, radix);
+            }
+        }
+    }
+    verify_split_exponent(gen, 700, true, pmp::io::oct, pmp::radix::compact);
+    verify_split_exponent(gen, 700, false, pmp::io::oct, pmp::radix::compact);
+    return 0;
+}
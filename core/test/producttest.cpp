@@ -0,0 +1,96 @@
+#include "TestUtils.hpp"
+
+std::string chained_factorial(pmp::context& context, uint64_t n) {
+    //The linear chain a user would build through the operators, updated every 1000 steps to bound its depth.
+    pmp::integer F("1", context);
+    for (uint64_t i = 2; i <= n; i++) {
+        F = F * i;
+        if (i % 1000 == 0) {
+            context.update();
+        }
+    }
+    return to_string(F);
+}
+
+void verify_product(std::mt19937& gen, size_t count, size_t max_digits, mpengine::IOBasic iobasic, mpengine::StoreRadix radix) {
+    //Random signed factors of random lengths, the tree against the chain.
+    std::uniform_int_distribution<size_t> udist_digits(1, max_digits);
+    std::bernoulli_distribution bdist_negative(0.5);
+    pmp::context context(count * max_digits + 64, iobasic, radix);
+    std::vector<pmp::integer> integers;
+    for (size_t i = 0; i < count; i++) {
+        const std::string str_A = random_integer(gen, udist_digits(gen), iobasic);
+        integers.emplace_back((bdist_negative(gen) ? "-" + str_A : str_A).c_str(), context);
+    }
+    pmp::integer P = product(integers);
+    pmp::integer R = integers.front();
+    for (size_t i = 1; i < count; i++) {
+        R = R * integers[i];
+    }
+    check(to_string(P), to_string(R));
+    return;
+}
+
+void verify_factorials(uint64_t n, mpengine::IOBasic iobasic, mpengine::StoreRadix radix) {
+    //n! by the tree and by the chain, binomials against the ratios of the factorials.
+    pmp::context context(8 * n + 256, iobasic, radix);
+    pmp::integer F = factorial(context, n);
+    check(to_string(F), chained_factorial(context, n));
+    for (uint64_t k: std::vector<uint64_t>{0, 1, n / 3, n / 2, n}) {
+        pmp::integer C = binomial(context, n, k);
+        pmp::integer A = factorial(context, k), B = factorial(context, n - k);
+        pmp::integer D = A * B;
+        pmp::integer E = F / D;
+        check(to_string(C), to_string(E));
+    }
+    pmp::integer P = product(context, n + 1, 2 * n + 1), Q = factorial(context, 2 * n);
+    pmp::integer G = F * P;
+    check(to_string(G), to_string(Q));
+    return;
+}
+
+void benchmark(uint64_t n, mpengine::IOBasic iobasic) {
+    //n! as a product tree against the chain of scalar products.
+    pmp::context context(5 * n, iobasic);
+    Stopwatch stopwatch;
+    pmp::integer F = factorial(context, n);
+    const std::string str_F = to_string(F);
+    const int64_t elapsed_tree = stopwatch.lap<std::chrono::microseconds>();
+    const std::string str_R = chained_factorial(context, n);
+    const int64_t elapsed_chain = stopwatch.lap<std::chrono::microseconds>();
+    check(str_F, str_R);
+    std::cout << mpengine::iofun::base_name(iobasic) << " factorial of " << n << " (" << str_F.length() << " digits) by a product tree in "
+              << elapsed_tree << "us, by a chain in " << elapsed_chain << "us." << std::endl;
+    return;
+}
+
+int main() {
+    putils::ThreadPool::set_global_threadpool(4);
+    std::mt19937 gen(20250815);
+
+    for (auto radix: {pmp::radix::compact, pmp::radix::native, pmp::radix::wide}) {
+        //Empty ranges, ranges through zero and small known values.
+        pmp::context context(100, pmp::io::dec, radix);
+        check(to_string(factorial(context, 0)), "1");
+        check(to_string(factorial(context, 1)), "1");
+        check(to_string(factorial(context, 25)), "15511210043330985984000000");
+        check(to_string(product(context, 7, 7)), "1");
+        check(to_string(product(context, 0, 9)), "0");
+        check(to_string(product(context, 3, 6)), "60");
+        check(to_string(binomial(context, 5, 7)), "0");
+        check(to_string(binomial(context, 5, 0)), "1");
+        check(to_string(binomial(context, 1000, 3)), "166167000");
+        check(to_string(binomial(context, 100, 50)), "100891344545564193334812497256");
+
+        for (auto iobasic: {mpengine::IOBasic::oct, mpengine::IOBasic::dec, mpengine::IOBasic::hex}) {
+            for (uint64_t n: {2, 21, 100, 700}) {
+                verify_factorials(n, iobasic, radix);
+            }
+            verify_product(gen, 1, 30, iobasic, radix);
+            verify_product(gen, 7, 30, iobasic, radix);
+            verify_product(gen, 100, 200, iobasic, radix);
+        }
+    }
+    benchmark(10000, mpengine::IOBasic::dec);
+    return 0;
+}
@@ -0,0 +1,70 @@
+#include "TestUtils.hpp"
+
+void verify_round_trip(std::mt19937& gen, size_t digits, mpengine::IOBasic iobasic, mpengine::StoreRadix radix) {
+    std::string str = "-" + random_integer(gen, digits, iobasic);
+    const size_t log_len = mpengine::iofun::precision_to_log_len(digits, iobasic, radix);
+    mpengine::BasicIntegerType X(log_len, iobasic, radix);
+    mpengine::parse_string_to_integer(str, X);
+    std::ostringstream oss;
+    mpengine::parse_integer_to_stream(oss, X);
+    if (oss.str() != str) {
+        throw PUTILS_GENERAL_EXCEPTION("Native or wide limbs fail to reproduce the parsed integer!", "test error");
+    }
+    return;
+}
+
+std::string evaluate(const std::string& str_A, const std::string& str_B, size_t precision, mpengine::IOBasic iobasic, mpengine::StoreRadix radix, long long& elapsed) {
+    Stopwatch stopwatch;
+    pmp::context context(precision, iobasic, radix);
+    pmp::integer A(str_A.c_str(), context);
+    pmp::integer B(str_B.c_str(), context);
+    pmp::integer P = A * B;
+    pmp::integer C = P + A;
+    std::ostringstream oss;
+    oss << C;
+    elapsed = stopwatch.lap<std::chrono::milliseconds>();
+    return oss.str();
+}
+
+void verify_against_compact(std::mt19937& gen, size_t precision, mpengine::IOBasic iobasic, mpengine::StoreRadix radix) {
+    //Operands fill half of the context precision, so the results never overflow.
+    std::string str_A = random_integer(gen, precision / 2 - 24, iobasic);
+    std::string str_B = "-" + random_integer(gen, precision / 2 - 24, iobasic);
+    long long elapsed_radix, elapsed_compact;
+    std::string result_radix = evaluate(str_A, str_B, precision, iobasic, radix, elapsed_radix);
+    std::string result_compact = evaluate(str_A, str_B, precision, iobasic, pmp::radix::compact, elapsed_compact);
+    if (result_radix != result_compact) {
+        throw PUTILS_GENERAL_EXCEPTION("Native or wide radix result mismatches the compact radix result!", "test error");
+    }
+    std::cout << mpengine::iofun::base_name(iobasic) << " operands of " << str_A.length() << " digits verified: "
+              << mpengine::iofun::radix_name(radix) << " " << elapsed_radix << "ms, compact " << elapsed_compact << "ms." << std::endl;
+    return;
+}
+
+int main() {
+    std::mt19937 gen(20250815);
+    for (auto radix: {pmp::radix::native, pmp::radix::wide}) {
+        for (auto iobasic: {mpengine::IOBasic::oct, mpengine::IOBasic::dec, mpengine::IOBasic::hex}) {
+            for (size_t digits: {1, 15, 16, 18, 19, 20, 21, 22, 63, 64, 1000, 4097}) {
+                verify_round_trip(gen, digits, iobasic, radix);
+            }
+        }
+    }
+    //Serial and parallel Karatsuba, Toom-3, Toom-4 and NTT tiers over native decimal limbs (19 digits per limb).
+    verify_against_compact(gen, 1000, mpengine::IOBasic::dec, pmp::radix::native);
+    verify_against_compact(gen, 19 * 512, mpengine::IOBasic::dec, pmp::radix::native);
+    verify_against_compact(gen, 19 * 1024, mpengine::IOBasic::dec, pmp::radix::native);
+    verify_against_compact(gen, 19 * 2048, mpengine::IOBasic::dec, pmp::radix::native);
+    verify_against_compact(gen, 19 * 8192, mpengine::IOBasic::dec, pmp::radix::native);
+    verify_against_compact(gen, 16 * 8192, mpengine::IOBasic::hex, pmp::radix::native);
+    verify_against_compact(gen, 21 * 2048, mpengine::IOBasic::oct, pmp::radix::native);
+    //The same tiers over wide decimal limbs (18 digits per limb), whose NTT takes two pieces of 10 ^ 9 per limb.
+    verify_against_compact(gen, 1000, mpengine::IOBasic::dec, pmp::radix::wide);
+    verify_against_compact(gen, 18 * 512, mpengine::IOBasic::dec, pmp::radix::wide);
+    verify_against_compact(gen, 18 * 1024, mpengine::IOBasic::dec, pmp::radix::wide);
+    verify_against_compact(gen, 18 * 2048, mpengine::IOBasic::dec, pmp::radix::wide);
+    verify_against_compact(gen, 18 * 8192, mpengine::IOBasic::dec, pmp::radix::wide);
+    verify_against_compact(gen, 15 * 8192, mpengine::IOBasic::hex, pmp::radix::wide);
+    verify_against_compact(gen, 20 * 2048, mpengine::IOBasic::oct, pmp::radix::wide);
+    return 0;
+}
@@ -0,0 +1,89 @@
+#include "TestUtils.hpp"
+
+std::string word_to_string(uint64_t word, mpengine::IOBasic iobasic) {
+    const char* alphabet = "0123456789abcdef";
+    const uint64_t io_base = mpengine::iofun::io_base(iobasic);
+    std::string result;
+    do {
+        result.insert(result.begin(), alphabet[word % io_base]);
+        word /= io_base;
+    } while (word != 0ull);
+    return result;
+}
+
+void verify_scalar(const std::string& str_A, uint64_t scalar, mpengine::IOBasic iobasic, mpengine::StoreRadix radix) {
+    //Scalar nodes against the general multiplication and division nodes with the word as a constant.
+    pmp::context context(2 * str_A.length() + 64, iobasic, radix);
+    pmp::integer A(str_A.c_str(), context);
+    pmp::integer S(word_to_string(scalar, iobasic).c_str(), context);
+    pmp::integer P = A * scalar, Q = A / scalar, R = A % scalar, T = scalar * A;
+    pmp::integer P_ref = A * S, Q_ref = A / S, R_ref = A % S;
+    check(to_string(P), to_string(P_ref));
+    check(to_string(T), to_string(P_ref));
+    check(to_string(Q), to_string(Q_ref));
+    check(to_string(R), to_string(R_ref));
+    return;
+}
+
+void benchmark(std::mt19937& gen, size_t digits, uint64_t scalar) {
+    pmp::context context(2 * digits + 64, pmp::io::dec);
+    pmp::integer A(random_integer(gen, digits, mpengine::IOBasic::dec).c_str(), context);
+    pmp::integer S(word_to_string(scalar, mpengine::IOBasic::dec).c_str(), context);
+    context.update();
+    Stopwatch stopwatch;
+    pmp::integer P = A * scalar;
+    pmp::integer Q = A / scalar;
+    context.update();
+    const int64_t elapsed_scalar = stopwatch.lap<std::chrono::microseconds>();
+    pmp::integer P_ref = A * S;
+    pmp::integer Q_ref = A / S;
+    context.update();
+    const int64_t elapsed_general = stopwatch.lap<std::chrono::microseconds>();
+    std::cout << "Scalar product and quotient of " << digits << " digits by " << scalar << " in "
+              << elapsed_scalar << "us, general nodes in " << elapsed_general << "us." << std::endl;
+    return;
+}
+
+int main() {
+    putils::ThreadPool::set_global_threadpool(4);
+    std::mt19937 gen(20250815);
+
+    for (auto radix: {pmp::radix::compact, pmp::radix::native, pmp::radix::wide}) {
+        for (auto iobasic: {mpengine::IOBasic::oct, mpengine::IOBasic::dec, mpengine::IOBasic::hex}) {
+            //Words below and above the store base, up to the largest word.
+            for (uint64_t scalar: {1ull, 7ull, 99999999ull, 100000000ull, 268435456ull, 4294967311ull, 12345678901234567ull, 18446744073709551615ull}) {
+                for (size_t digits: {1, 30, 700}) {
+                    const std::string str_A = random_integer(gen, digits, iobasic);
+                    verify_scalar(str_A, scalar, iobasic, radix);
+                    verify_scalar("-" + str_A, scalar, iobasic, radix);
+                }
+            }
+        }
+
+        //Factorial accumulation, digit extraction and division by zero.
+        pmp::context context(200, pmp::io::dec, radix);
+        pmp::integer F("1", context);
+        for (uint64_t i = 2; i <= 30; i++) {
+            F = F * i;
+        }
+        check(to_string(F), "265252859812191058636308480000000");
+        std::string digits;
+        pmp::integer X = F;
+        for (int i = 0; i < 33; i++) {
+            pmp::integer D = X % 10;
+            digits.insert(digits.begin(), to_string(D).front());
+            X = X / 10;
+        }
+        check(digits, to_string(F));
+        check(to_string(X), "0");
+        pmp::integer N("-17", context);
+        pmp::integer Q = N / 5, R = N % 5, Z = N / 0;
+        check(to_string(Q), "-3");
+        check(to_string(R), "-2");
+        check(to_string(Z), "0");
+    }
+
+    benchmark(gen, 100000, 12345ull);
+    benchmark(gen, 100000, 18446744073709551557ull);
+    return 0;
+}
@@ -0,0 +1,123 @@
+#include "TestUtils.hpp"
+
+pmp::integer binary_search_isqrt(pmp::integer& N, size_t steps) {
+    //Bisects lo ^ 2 <= N < hi ^ 2 with selections only, the whole search is a single DAG.
+    pmp::context context = N.get_context();
+    pmp::integer lo("0", context), one("1", context);
+    pmp::integer hi = N + one;
+    for (size_t i = 0; i < steps; i++) {
+        pmp::integer S = lo + hi;
+        pmp::integer M = S / 2ull;
+        pmp::integer Q = M * M;
+        pmp::integer P = N < Q;
+        pmp::integer H = select(P, M, hi), L = select(P, lo, M);
+        hi = H;
+        lo = L;
+    }
+    return lo;
+}
+
+pmp::integer euclid_gcd(pmp::integer& A, pmp::integer& B, size_t steps) {
+    //Runs a fixed number of Euclid steps, the finished ones select the pair unchanged.
+    pmp::context context = A.get_context();
+    pmp::integer zero("0", context), one("1", context);
+    pmp::integer a = A, b = B;
+    for (size_t i = 0; i < steps; i++) {
+        pmp::integer done = b == zero;
+        pmp::integer d = select(done, one, b);
+        pmp::integer r = a % d;
+        pmp::integer a_next = select(done, a, b), b_next = select(done, b, r);
+        a = a_next;
+        b = b_next;
+    }
+    return a;
+}
+
+void verify(std::mt19937& gen, size_t digits, mpengine::IOBasic iobasic, mpengine::StoreRadix radix) {
+    const std::string str_N = random_integer(gen, digits, iobasic), str_X = random_integer(gen, digits, iobasic);
+    pmp::context context(4 * digits + 64, iobasic, radix);
+    pmp::integer N(str_N.c_str(), context), X(str_X.c_str(), context), Y(("-" + str_X).c_str(), context);
+    pmp::integer C1 = cmp(N, X), C2 = cmp(X, N), C3 = cmp(X, X), C4 = cmp(Y, X), C5 = cmp(X, Y);
+    pmp::integer L1 = N < X, L2 = Y < X, L3 = X < X, E1 = X == X, E2 = X == Y;
+    //The random integers have the same number of digits, so they are ordered as strings.
+    const int order = str_N.compare(str_X);
+    check(to_string(C1), order == 0 ? "0" : order < 0 ? "-1" : "1");
+    check(to_string(C2), order == 0 ? "0" : order < 0 ? "1" : "-1");
+    check(to_string(C3), "0");
+    check(to_string(C4), "-1");
+    check(to_string(C5), "1");
+    check(to_string(L1), order < 0 ? "1" : "0");
+    check(to_string(L2), "1");
+    check(to_string(L3), "0");
+    check(to_string(E1), "1");
+    check(to_string(E2), "0");
+
+    //Clamping X into [Y, N] by two selections.
+    pmp::integer below = X < Y, above = N < X;
+    pmp::integer T = select(above, N, X);
+    pmp::integer K = select(below, Y, T);
+    check(to_string(K), order < 0 ? str_N : str_X);
+
+    const size_t steps = 4 * digits + 8;
+    pmp::integer R = binary_search_isqrt(N, steps);
+    pmp::integer G = euclid_gcd(N, X, 12 * digits + 8), H = gcd(N, X);
+    auto [S, _] = isqrt(N);
+    check(to_string(R), to_string(S));
+    check(to_string(G), to_string(H));
+    return;
+}
+
+void benchmark(size_t digits, mpengine::IOBasic iobasic) {
+    //The bisection of an integer square root as a single DAG, against the square root node.
+    std::mt19937 gen(20250815);
+    const std::string str_N = random_integer(gen, digits, iobasic);
+    pmp::context context(2 * digits + 64, iobasic);
+    pmp::integer N(str_N.c_str(), context);
+    Stopwatch stopwatch;
+    pmp::integer R = binary_search_isqrt(N, 4 * digits + 8);
+    const std::string str_R = to_string(R);
+    const int64_t elapsed_bisection = stopwatch.lap<std::chrono::microseconds>();
+    auto [S, _] = isqrt(N);
+    const std::string str_S = to_string(S);
+    const int64_t elapsed_node = stopwatch.lap<std::chrono::microseconds>();
+    check(str_R, str_S);
+    std::cout << mpengine::iofun::base_name(iobasic) << " bisection square root of " << digits << " digits in "
+              << elapsed_bisection << "us, square root node in " << elapsed_node << "us." << std::endl;
+    return;
+}
+
+int main() {
+    putils::ThreadPool::set_global_threadpool(4);
+    std::mt19937 gen(20250815);
+
+    for (auto radix: {pmp::radix::compact, pmp::radix::native, pmp::radix::wide}) {
+        //Zeros, signs and selections consumed by further arithmetic.
+        pmp::context context(100, pmp::io::dec, radix);
+        pmp::integer A("12345678901234567890123", context), B("-12345678901234567890123", context), Z("0", context);
+        pmp::integer N = Z - Z, M = -Z;
+        pmp::integer C1 = cmp(N, Z), C2 = cmp(M, Z), C3 = cmp(B, Z), C4 = cmp(Z, B), C5 = cmp(A, B);
+        pmp::integer E = N == M, L = B < M;
+        pmp::integer S = select(L, A, B), T = select(Z, A, B);
+        pmp::integer U = S + T, V = S * A, W = -S;
+        check(to_string(C1), "0");
+        check(to_string(C2), "0");
+        check(to_string(C3), "-1");
+        check(to_string(C4), "1");
+        check(to_string(C5), "1");
+        check(to_string(E), "1");
+        check(to_string(L), "1");
+        check(to_string(S), "12345678901234567890123");
+        check(to_string(T), "-12345678901234567890123");
+        check(to_string(U), "0");
+        check(to_string(V), "152415787532388367504942236884722755800955129");
+        check(to_string(W), "-12345678901234567890123");
+
+        for (auto iobasic: {mpengine::IOBasic::oct, mpengine::IOBasic::dec, mpengine::IOBasic::hex}) {
+            for (size_t digits: {1, 12, 40}) {
+                verify(gen, digits, iobasic, radix);
+            }
+        }
+    }
+    benchmark(200, mpengine::IOBasic::dec);
+    return 0;
+}
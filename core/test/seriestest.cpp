@@ -0,0 +1,115 @@
+#include <cmath>
+
+#include "TestUtils.hpp"
+
+const std::string e_digits = "27182818284590452353602874713526624977572470936999595749669676277240766303535475945713821785251664274";
+const std::string pi_digits = "31415926535897932384626433832795028841971693993751058209749445923078164062862089986280348253421170679";
+
+std::string compute_e(size_t digits, mpengine::IOBasic iobasic, mpengine::StoreRadix radix) {
+    //e = sum 1 / n!, with p(n) = 1, q(n) = n (q(0) = 1) and a(n) = 1, to the given number of io digits.
+    pmp::context context(4 * digits + 1024, iobasic, radix);
+    pmp::integer one("1", context);
+    const double log_base = std::log(static_cast<double>(mpengine::iofun::io_base(iobasic)));
+    uint64_t terms = 1;
+    for (double log_factorial = 0.0; log_factorial < (digits + 8) * log_base; terms++) {
+        log_factorial += std::log(static_cast<double>(terms));
+    }
+    auto [Q, T] = binary_splitting(context, 0, terms, [&one](pmp::context&, uint64_t n) {
+        return pmp::series_term{one, n == 0 ? one : one * n, one};
+    });
+    pmp::integer U = digit_shift_left(T, digits);
+    pmp::integer E = U / Q;
+    return to_string(E);
+}
+
+std::string compute_pi(size_t digits, mpengine::IOBasic iobasic, mpengine::StoreRadix radix) {
+    //The Chudnovsky series, pi = 426880 * sqrt(10005) * Q / T, about 14 decimal digits per term.
+    pmp::context context(8 * digits + 1024, iobasic, radix);
+    pmp::integer one("1", context);
+    const double log_base = std::log(static_cast<double>(mpengine::iofun::io_base(iobasic)));
+    const uint64_t terms = static_cast<uint64_t>((digits + 8) * log_base / std::log(151931373056000.0)) + 2;
+    auto [Q, T] = binary_splitting(context, 0, terms, [&one](pmp::context&, uint64_t n) {
+        if (n == 0) {
+            return pmp::series_term{one, one, one * 13591409ull};
+        }
+        pmp::integer w = one * ((6 * n - 5) * (2 * n - 1) * (6 * n - 1));
+        pmp::integer v = one * (n * n * n);
+        return pmp::series_term{-w, v * 10939058860032000ull, one * (13591409ull + 545140134ull * n)};
+    });
+    pmp::integer C = one * 10005ull;
+    pmp::integer D = digit_shift_left(C, 2 * digits);
+    auto [R, _] = isqrt(D);
+    pmp::integer X = R * Q;
+    pmp::integer Y = X * 426880ull;
+    pmp::integer P = Y / T;
+    return to_string(P);
+}
+
+void verify(std::mt19937& gen, uint64_t terms, mpengine::IOBasic iobasic, mpengine::StoreRadix radix) {
+    //Binary splitting against the sequential fold of the same recurrence, both are exact.
+    std::uniform_int_distribution<uint64_t> udist_word(1, 1000000);
+    std::bernoulli_distribution bdist_negative(0.5);
+    std::vector<uint64_t> ps(terms), qs(terms), as(terms);
+    std::vector<bool> p_signs(terms), a_signs(terms);
+    for (uint64_t n = 0; n < terms; n++) {
+        ps[n] = udist_word(gen), qs[n] = udist_word(gen), as[n] = udist_word(gen) - 1;
+        p_signs[n] = bdist_negative(gen), a_signs[n] = bdist_negative(gen);
+    }
+    pmp::context context(32 * terms + 64, iobasic, radix);
+    pmp::integer one("1", context);
+    auto generator = [&](pmp::context&, uint64_t n) {
+        pmp::integer p = one * ps[n], a = one * as[n];
+        return pmp::series_term{p_signs[n] ? -p : p, one * qs[n], a_signs[n] ? -a : a};
+    };
+    auto [Q, T] = binary_splitting(context, 0, terms, generator);
+    pmp::series_term first = generator(context, 0);
+    pmp::integer P_fold = first.p, Q_fold = first.q, T_fold = first.a * first.p;
+    for (uint64_t n = 1; n < terms; n++) {
+        pmp::series_term term = generator(context, n);
+        pmp::integer U = T_fold * term.q, V = P_fold * term.p;
+        pmp::integer W = V * term.a;
+        T_fold = U + W;
+        P_fold = V;
+        Q_fold = Q_fold * term.q;
+    }
+    check(to_string(Q), to_string(Q_fold));
+    check(to_string(T), to_string(T_fold));
+    return;
+}
+
+void benchmark(size_t digits) {
+    //The constants in a default context, digits of the decimal base.
+    Stopwatch stopwatch;
+    const std::string str_e = compute_e(digits, mpengine::IOBasic::dec, mpengine::StoreRadix::compact);
+    const int64_t elapsed_e = stopwatch.lap<std::chrono::microseconds>();
+    const std::string str_pi = compute_pi(digits, mpengine::IOBasic::dec, mpengine::StoreRadix::compact);
+    const int64_t elapsed_pi = stopwatch.lap<std::chrono::microseconds>();
+    check(str_e.substr(0, e_digits.length()), e_digits);
+    check(str_pi.substr(0, pi_digits.length()), pi_digits);
+    std::cout << "Binary splitting of " << digits << " digits, e in "
+              << elapsed_e << "us, pi in " << elapsed_pi << "us." << std::endl;
+    return;
+}
+
+int main() {
+    putils::ThreadPool::set_global_threadpool(4);
+    std::mt19937 gen(20250815);
+
+    for (auto radix: {pmp::radix::compact, pmp::radix::native, pmp::radix::wide}) {
+        //The constants agree over the radices, up to the last digits lost to truncation.
+        const std::string str_e = compute_e(1000, mpengine::IOBasic::dec, radix);
+        const std::string str_pi = compute_pi(1000, mpengine::IOBasic::dec, radix);
+        check(str_e.substr(0, e_digits.length()), e_digits);
+        check(str_pi.substr(0, pi_digits.length()), pi_digits);
+        check(str_e.substr(0, 990), compute_e(1010, mpengine::IOBasic::dec, pmp::radix::compact).substr(0, 990));
+        check(str_pi.substr(0, 990), compute_pi(1010, mpengine::IOBasic::dec, pmp::radix::compact).substr(0, 990));
+
+        for (auto iobasic: {mpengine::IOBasic::oct, mpengine::IOBasic::dec, mpengine::IOBasic::hex}) {
+            for (uint64_t terms: {1, 2, 7, 100}) {
+                verify(gen, terms, iobasic, radix);
+            }
+        }
+    }
+    benchmark(5000);
+    return 0;
+}
@@ -0,0 +1,94 @@
+#include "TestUtils.hpp"
+
+void verify_bit_shift(const std::string& str_A, size_t bits, mpengine::IOBasic iobasic, mpengine::StoreRadix radix) {
+    //Bit shifts against repeated scalar multiplications and divisions by powers of two.
+    pmp::context context(str_A.length() + bits + 64, iobasic, radix);
+    pmp::integer A(str_A.c_str(), context);
+    pmp::integer L = A << bits, R = A >> bits;
+    pmp::integer L_ref = A, R_ref = A;
+    for (size_t rest = bits; rest > 0; rest -= std::min<size_t>(rest, 60)) {
+        const uint64_t factor = 1ull << std::min<size_t>(rest, 60);
+        L_ref = L_ref * factor;
+        R_ref = R_ref / factor;
+    }
+    check(to_string(L), to_string(L_ref));
+    check(to_string(R), to_string(R_ref));
+    return;
+}
+
+void verify_digit_shift(const std::string& str_A, size_t digits, mpengine::IOBasic iobasic, mpengine::StoreRadix radix) {
+    //Digit shifts append or drop the last digits of the printed integer.
+    pmp::context context(str_A.length() + digits + 64, iobasic, radix);
+    pmp::integer A(str_A.c_str(), context);
+    pmp::integer L = digit_shift_left(A, digits), R = digit_shift_right(A, digits);
+    const bool negative = str_A.front() == '-';
+    const size_t magnitude = str_A.length() - negative;
+    check(to_string(L), str_A + std::string(digits, '0'));
+    check(to_string(R), digits >= magnitude ? "0" : str_A.substr(0, str_A.length() - digits));
+    return;
+}
+
+void benchmark(std::mt19937& gen, size_t digits, size_t bits, mpengine::IOBasic iobasic) {
+    pmp::context context(digits + bits + 64, iobasic);
+    pmp::integer A(random_integer(gen, digits, iobasic).c_str(), context);
+    context.update();
+    Stopwatch stopwatch;
+    pmp::integer L = A << bits;
+    pmp::integer R = L >> bits;
+    context.update();
+    const int64_t elapsed = stopwatch.lap<std::chrono::microseconds>();
+    check(to_string(R), to_string(A));
+    std::cout << mpengine::iofun::base_name(iobasic) << " shifts of " << digits << " digits by " << bits << " bits in "
+              << elapsed << "us." << std::endl;
+    return;
+}
+
+int main() {
+    putils::ThreadPool::set_global_threadpool(4);
+    std::mt19937 gen(20250815);
+
+    for (auto radix: {pmp::radix::compact, pmp::radix::native, pmp::radix::wide}) {
+        for (auto iobasic: {mpengine::IOBasic::oct, mpengine::IOBasic::dec, mpengine::IOBasic::hex}) {
+            //Sub-limb, whole-limb and multi-limb shifts, including the serial fallback for large decimal bit shifts.
+            for (size_t count: {0, 1, 3, 8, 27, 28, 64, 65, 200, 1000}) {
+                for (size_t digits: {1, 30, 700}) {
+                    const std::string str_A = random_integer(gen, digits, iobasic);
+                    verify_bit_shift(str_A, count, iobasic, radix);
+                    verify_bit_shift("-" + str_A, count, iobasic, radix);
+                    verify_digit_shift(str_A, count, iobasic, radix);
+                    verify_digit_shift("-" + str_A, count, iobasic, radix);
+                }
+            }
+        }
+
+        //Shifting out every digit leaves a positive zero, overflowing drops the high limbs.
+        pmp::context context(20, pmp::io::dec, radix);
+        pmp::integer N("-12345", context);
+        pmp::integer Z = N >> 14, D = digit_shift_right(N, 5), S = N >> 3;
+        check(to_string(Z), "0");
+        check(to_string(D), "0");
+        check(to_string(S), "-1543");
+    }
+
+    //Operands above the parallel threshold are shifted in chunks.
+    for (auto iobasic: {mpengine::IOBasic::oct, mpengine::IOBasic::dec, mpengine::IOBasic::hex}) {
+        const std::string str_A = random_integer(gen, 1200000, iobasic);
+        verify_digit_shift(str_A, 1000, iobasic, pmp::radix::compact);
+        verify_digit_shift(str_A, 13, iobasic, pmp::radix::compact);
+        benchmark(gen, 1200000, iobasic == mpengine::IOBasic::dec ? 5 : 1001, iobasic);
+    }
+
+    //A difference bounded by large operands but using few limbs is chunked over the limbs it uses.
+    for (auto radix: {pmp::radix::compact, pmp::radix::native, pmp::radix::wide}) {
+        const std::string str_A = random_integer(gen, 1200000);
+        pmp::context context(str_A.length() + 2000, pmp::io::dec, radix);
+        pmp::integer A(str_A.c_str(), context), B("12345", context);
+        pmp::integer P = A + B;
+        pmp::integer D = P - A;
+        pmp::integer L = digit_shift_left(D, 1000), R = digit_shift_right(L, 998), S = L >> 3;
+        check(to_string(L), "12345" + std::string(1000, '0'));
+        check(to_string(R), "1234500");
+        check(to_string(S), to_string(L / 8ull));
+    }
+    return 0;
+}
@@ -0,0 +1,72 @@
+#include "TestUtils.hpp"
+
+bool less_than(const std::string& str_A, const std::string& str_B) {
+    //Compares non-negative integers of the same io base.
+    return str_A.length() != str_B.length() ? str_A.length() < str_B.length() : str_A < str_B;
+}
+
+void verify_sqrt(const std::string& str_A, size_t precision, mpengine::IOBasic iobasic, mpengine::StoreRadix radix) {
+    //Checks A = S ^ 2 + R with 0 <= R <= 2S.
+    Stopwatch stopwatch;
+    pmp::context context(precision, iobasic, radix);
+    pmp::integer A(str_A.c_str(), context);
+    auto [S, R] = pmp::isqrt(A);
+    pmp::integer P = S * S;
+    pmp::integer C = P + R;
+    pmp::integer T = S + S;
+    std::ostringstream oss_R, oss_C, oss_T;
+    oss_R << R;
+    oss_C << C;
+    oss_T << T;
+    const int64_t elapsed = stopwatch.lap<std::chrono::milliseconds>();
+    if (oss_C.str() != str_A) {
+        throw PUTILS_GENERAL_EXCEPTION("Root and remainder fail to reproduce the operand!", "test error");
+    }
+    if (oss_R.str().front() == '-' || less_than(oss_T.str(), oss_R.str())) {
+        throw PUTILS_GENERAL_EXCEPTION("Remainder is out of range!", "test error");
+    }
+    std::cout << mpengine::iofun::base_name(iobasic) << " " << mpengine::iofun::radix_name(radix) << " square root of "
+              << str_A.length() << " digits verified in "
+              << elapsed << "ms." << std::endl;
+    return;
+}
+
+void check(const std::string& str_A, const std::string& expected_S, const std::string& expected_R) {
+    pmp::context context(1000, pmp::io::dec);
+    pmp::integer A(str_A.c_str(), context);
+    auto [S, R] = pmp::isqrt(A);
+    std::ostringstream oss_S, oss_R;
+    oss_S << S;
+    oss_R << R;
+    if (oss_S.str() != expected_S || oss_R.str() != expected_R) {
+        throw PUTILS_GENERAL_EXCEPTION("Square root mismatches the expected root and remainder!", "test error");
+    }
+    return;
+}
+
+int main() {
+    std::mt19937 gen(20250815);
+    check("0", "0", "0");
+    check("1", "1", "0");
+    check("15", "3", "6");
+    check("16", "4", "0");
+    check("99999999", "9999", "19998");
+    check("100000000", "10000", "0");
+    check("-4", "0", "0");
+
+    for (auto radix: {pmp::radix::compact, pmp::radix::native, pmp::radix::wide}) {
+        for (auto iobasic: {mpengine::IOBasic::oct, mpengine::IOBasic::dec, mpengine::IOBasic::hex}) {
+            for (size_t digits: {1, 2, 9, 17, 18, 33, 100, 257, 1000, 4001, 20000, 40000}) {
+                verify_sqrt(random_integer(gen, digits, iobasic), 80000, iobasic, radix);
+            }
+        }
+    }
+
+    //Perfect squares and their neighbours exercise the corrections in both directions.
+    const std::string nines(20000, '9'), power = "1" + std::string(40000, '0');
+    verify_sqrt(nines + nines, 80000, pmp::io::dec, pmp::radix::compact);
+    verify_sqrt(power, 80000, pmp::io::dec, pmp::radix::compact);
+    verify_sqrt(nines + "8" + std::string(19999, '0') + "1", 80000, pmp::io::dec, pmp::radix::native);
+    verify_sqrt(nines + nines, 80000, pmp::io::dec, pmp::radix::native);
+    return 0;
+}
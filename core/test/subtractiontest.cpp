@@ -0,0 +1,79 @@
+#include "TestUtils.hpp"
+
+void check_difference(const std::string& str_A, const std::string& str_B, const std::string& expected, mpengine::StoreRadix radix) {
+    pmp::context context(200, pmp::io::dec, radix);
+    pmp::integer A(str_A.c_str(), context);
+    pmp::integer B(str_B.c_str(), context);
+    pmp::integer C = A - B;
+    check(to_string(C), expected);
+    return;
+}
+
+void verify_difference(std::mt19937& gen, size_t precision, mpengine::StoreRadix radix) {
+    //A - B = A + (-B) = -(B - A), and (A - B) + B = A, for magnitudes of both orders.
+    const std::string str_A = random_integer(gen, precision - 8), str_B = random_integer(gen, precision - 16);
+    Stopwatch stopwatch;
+    pmp::context context(precision, pmp::io::dec, radix);
+    pmp::integer A(str_A.c_str(), context);
+    pmp::integer B(str_B.c_str(), context);
+    pmp::integer C = A - B;
+    pmp::integer N = -B;
+    pmp::integer D = A + N;
+    pmp::integer E = B - A;
+    pmp::integer F = -E;
+    pmp::integer G = C + B;
+    const std::string str_C = to_string(C);
+    const int64_t elapsed = stopwatch.lap<std::chrono::milliseconds>();
+    check(to_string(D), str_C);
+    check(to_string(F), str_C);
+    check(to_string(E), "-" + str_C);
+    check(to_string(G), str_A);
+    std::cout << mpengine::iofun::radix_name(radix) << " difference of " << str_A.length() << "-digit and " << str_B.length()
+              << "-digit operands verified in " << elapsed << "ms." << std::endl;
+    return;
+}
+
+int main() {
+    putils::ThreadPool::set_global_threadpool(4);
+    std::mt19937 gen(20250815);
+
+    for (auto radix: {pmp::radix::compact, pmp::radix::native, pmp::radix::wide}) {
+        //Every combination of signs and magnitude orders, and equal magnitudes.
+        check_difference("1000", "1", "999", radix);
+        check_difference("1", "1000", "-999", radix);
+        check_difference("-1", "1000", "-1001", radix);
+        check_difference("1", "-1000", "1001", radix);
+        check_difference("-1000", "-1", "-999", radix);
+        check_difference("-1", "-1000", "999", radix);
+        check_difference("123456789123456789", "123456789123456789", "0", radix);
+        check_difference("-123456789123456789", "-123456789123456789", "0", radix);
+        check_difference("0", "18446744073709551616", "-18446744073709551616", radix);
+
+        {
+            //Negations of constants, of negations, of zero, and of a computed node no longer referenced.
+            pmp::context context(200, pmp::io::dec, radix);
+            pmp::integer A("12345678901234567890", context);
+            pmp::integer Z("0", context);
+            pmp::integer N = -A;
+            pmp::integer M = -N;
+            pmp::integer O = -Z;
+            pmp::integer P = A * A;
+            P = -P;
+            check(to_string(N), "-12345678901234567890");
+            check(to_string(M), "12345678901234567890");
+            check(to_string(O), "0");
+            check(to_string(P), "-152415787532388367501905199875019052100");
+            //The view keeps the limbs of A while the negation is an operand of later nodes.
+            pmp::integer Q = N * A;
+            pmp::integer R = N - A;
+            check(to_string(Q), "-152415787532388367501905199875019052100");
+            check(to_string(R), "-24691357802469135780");
+        }
+
+        verify_difference(gen, 1000, radix);
+        verify_difference(gen, 20000, radix);
+    }
+    //Carry-select chunks, the native radix conversion of such operands takes too long for a test.
+    verify_difference(gen, 8 << 18, pmp::radix::compact);
+    return 0;
+}
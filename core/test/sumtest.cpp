@@ -0,0 +1,55 @@
+#include "TestUtils.hpp"
+
+void verify_sum(std::mt19937& gen, size_t terms, size_t max_digits, double negative_ratio, mpengine::IOBasic iobasic, mpengine::StoreRadix radix) {
+    //The summation node against a chain of addition nodes, operands of random lengths and signs.
+    std::uniform_int_distribution<size_t> udist_digits(1, max_digits);
+    std::bernoulli_distribution bdist_negative(negative_ratio);
+    pmp::context context(max_digits + 32, iobasic, radix);
+    std::vector<pmp::integer> integers;
+    for (size_t i = 0; i < terms; i++) {
+        const std::string str_A = random_integer(gen, udist_digits(gen), iobasic);
+        integers.emplace_back((bdist_negative(gen) ? "-" + str_A : str_A).c_str(), context);
+    }
+    Stopwatch stopwatch;
+    pmp::integer S = sum(integers);
+    const std::string str_S = to_string(S);
+    const int64_t elapsed_sum = stopwatch.lap<std::chrono::microseconds>();
+    pmp::integer R = integers.front();
+    for (size_t i = 1; i < terms; i++) {
+        R = R + integers[i];
+    }
+    const std::string str_R = to_string(R);
+    const int64_t elapsed_chain = stopwatch.lap<std::chrono::microseconds>();
+    check(str_S, str_R);
+    std::cout << mpengine::iofun::base_name(iobasic) << " " << mpengine::iofun::radix_name(radix) << " sum of " << terms
+              << " terms of up to " << max_digits << " digits in "
+              << elapsed_sum << "us, chained additions in " << elapsed_chain << "us." << std::endl;
+    return;
+}
+
+int main() {
+    putils::ThreadPool::set_global_threadpool(4);
+    std::mt19937 gen(20250815);
+
+    for (auto radix: {pmp::radix::compact, pmp::radix::native, pmp::radix::wide}) {
+        //Single operands, cancellation to zero and negative totals.
+        pmp::context context(100, pmp::io::dec, radix);
+        pmp::integer A("99999999999999999999", context), B("-99999999999999999999", context), C("1", context), D("-3", context);
+        check(to_string(pmp::sum({A})), "99999999999999999999");
+        check(to_string(pmp::sum({A, B})), "0");
+        check(to_string(pmp::sum({A, C, C})), "100000000000000000001");
+        check(to_string(pmp::sum({B, C, D})), "-100000000000000000001");
+        check(to_string(pmp::sum({A, A, A, B, D})), "199999999999999999995");
+
+        for (auto iobasic: {mpengine::IOBasic::oct, mpengine::IOBasic::dec, mpengine::IOBasic::hex}) {
+            verify_sum(gen, 10, 50, 0.0, iobasic, radix);
+            verify_sum(gen, 50, 600, 0.5, iobasic, radix);
+            verify_sum(gen, 300, 3000, 0.3, iobasic, radix);
+        }
+    }
+    //Operands and lengths above the parallel threshold are gathered in groups.
+    verify_sum(gen, 1000, 20000, 0.4, mpengine::IOBasic::dec, pmp::radix::compact);
+    verify_sum(gen, 1000, 20000, 0.4, mpengine::IOBasic::hex, pmp::radix::native);
+    verify_sum(gen, 20000, 100, 0.0, mpengine::IOBasic::dec, pmp::radix::compact);
+    return 0;
+}
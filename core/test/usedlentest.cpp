@@ -0,0 +1,68 @@
+#include "TestUtils.hpp"
+
+std::vector<std::string> evaluate(std::mt19937 gen, size_t digits, size_t capacity, mpengine::IOBasic iobasic, mpengine::StoreRadix radix) {
+    //Every operation on small operands in a context of the given capacity, the high limbs of every value are zeros.
+    pmp::context context(capacity, iobasic, radix);
+    const std::string str_X = random_integer(gen, digits, iobasic), str_Y = random_integer(gen, digits / 2 + 1, iobasic);
+    pmp::integer X(str_X.c_str(), context), Y(("-" + str_Y).c_str(), context), Z("0", context);
+    pmp::integer P = X * Y, Q = P * P;
+    pmp::integer S = X + Y, D = Y - X, N = Z - X;
+    pmp::integer M = X * 12345ull, L = X << 77, R = L >> 13;
+    pmp::integer F = S, T = pmp::sum({X, Y, P, N});
+    {
+        pmp::integer O = X * Y;
+        F = S + O;
+    }
+    pmp::integer V = Q / X, W = Q % Y, G = gcd(P, S);
+    auto [U, K] = isqrt(Q);
+    std::vector<std::string> results;
+    for (const pmp::integer* I: {&P, &Q, &S, &D, &N, &M, &L, &R, &F, &T, &V, &W, &G, &U, &K}) {
+        results.emplace_back(to_string(*I));
+    }
+    return results;
+}
+
+void verify(std::mt19937& gen, size_t digits, mpengine::IOBasic iobasic, mpengine::StoreRadix radix) {
+    const std::vector<std::string> tight = evaluate(gen, digits, 4 * digits + 64, iobasic, radix);
+    const std::vector<std::string> large = evaluate(gen, digits, 64 * digits + 4096, iobasic, radix);
+    for (size_t i = 0; i < tight.size(); i++) {
+        check(large[i], tight[i]);
+    }
+    gen.discard(1);
+    return;
+}
+
+void benchmark(size_t steps, size_t digits, mpengine::IOBasic iobasic) {
+    //The Fibonacci recurrence grows from one limb to the capacity of the context, then prints the last term.
+    pmp::context context(digits, iobasic);
+    Stopwatch stopwatch;
+    pmp::integer a("0", context), b("1", context);
+    for (size_t i = 2; i <= steps; i++) {
+        pmp::integer c = a + b;
+        a = b;
+        b = c;
+    }
+    pmp::integer P = a * b;
+    const std::string str_P = to_string(P);
+    const int64_t elapsed = stopwatch.lap<std::chrono::microseconds>();
+    std::cout << mpengine::iofun::base_name(iobasic) << " Fibonacci recurrence of " << steps << " steps in a context of "
+              << digits << " digits in " << elapsed << "us." << std::endl;
+    return;
+}
+
+int main() {
+    putils::ThreadPool::set_global_threadpool(4);
+    std::mt19937 gen(20250815);
+
+    for (auto radix: {pmp::radix::compact, pmp::radix::native, pmp::radix::wide}) {
+        for (auto iobasic: {mpengine::IOBasic::oct, mpengine::IOBasic::dec, mpengine::IOBasic::hex}) {
+            //Schoolbook, Karatsuba and NTT sized operands far below the capacity.
+            for (size_t digits: {1, 20, 300, 3000}) {
+                verify(gen, digits, iobasic, radix);
+            }
+        }
+    }
+    benchmark(3000, 200000, mpengine::IOBasic::dec);
+    benchmark(3000, 200000, mpengine::IOBasic::hex);
+    return 0;
+}
@@ -0,0 +1,107 @@
+#include <random>
+#include <chrono>
+#include <vector>
+#include <iostream>
+
+#include "ArithmeticFunctions.hpp"
+#include "IOFunctions.h"
+#include "GeneralException.h"
+
+using Limbs = std::vector<uint64_t>;
+
+bool scalar_addition(const Limbs& a, const Limbs& b, Limbs& c, uint64_t base) {
+    uint64_t carry = 0ull;
+    for (size_t i = 0; i < a.size(); i++) {
+        c[i] = a[i] + b[i] + carry;
+        carry = c[i] >= base;
+        c[i] -= carry ? base : 0ull;
+    }
+    return carry != 0ull;
+}
+
+bool scalar_subtraction(const Limbs& a, const Limbs& b, Limbs& c, uint64_t base) {
+    uint64_t borrow = 0ull;
+    for (size_t i = 0; i < a.size(); i++) {
+        const uint64_t subtrahend = b[i] + borrow;
+        borrow = a[i] < subtrahend;
+        c[i] = borrow ? a[i] + base - subtrahend : a[i] - subtrahend;
+    }
+    return borrow != 0ull;
+}
+
+Limbs random_limbs(std::mt19937_64& gen, size_t length, uint64_t base, int mode) {
+    //Mode 0: uniform limbs, mode 1: limbs near the carry boundaries, so long carry chains occur.
+    std::uniform_int_distribution<uint64_t> udist(0, base - 1), udist_small(0, 2);
+    Limbs result(length);
+    for (auto& limb: result) {
+        limb = mode == 0 ? udist(gen) : (udist_small(gen) == 0 ? udist_small(gen) : base - 1 - udist_small(gen));
+    }
+    return result;
+}
+
+void verify_kernels(std::mt19937_64& gen, size_t length, mpengine::IOBasic iobasic, int mode) {
+    const uint64_t base = mpengine::iofun::store_base(iobasic);
+    Limbs a = random_limbs(gen, length, base, mode), b = random_limbs(gen, length, base, mode);
+    if (length > 0 && mode == 1) {
+        //Equal prefixes exercise the borrow propagation and the comparison.
+        std::copy(a.begin() + length / 2, a.end(), b.begin() + length / 2);
+    }
+    Limbs c(length), d(length);
+    bool carry_ref = scalar_addition(a, b, c, base);
+    bool carry = mpengine::u64_variable_length_integer_addition_with_carry(a.data(), b.data(), d.data(), length, base);
+    if (carry != carry_ref || c != d) {
+        throw PUTILS_GENERAL_EXCEPTION("Vectorized addition mismatches the scalar loop!", "test error");
+    }
+    if (length > 0 && std::lexicographical_compare(a.rbegin(), a.rend(), b.rbegin(), b.rend())) {
+        std::swap(a, b);
+    }
+    carry_ref = scalar_subtraction(a, b, c, base);
+    carry = mpengine::u64_variable_length_integer_subtraction_with_carry_a_ge_b(a.data(), b.data(), d.data(), length, base);
+    if (carry != carry_ref || c != d) {
+        throw PUTILS_GENERAL_EXCEPTION("Vectorized subtraction mismatches the scalar loop!", "test error");
+    }
+    if (length > 0) {
+        const int expected = a == b ? 0 : 1;
+        if (mpengine::u64_variable_length_integer_compare(a.data(), b.data(), length) != expected ||
+            mpengine::u64_variable_length_integer_compare(b.data(), a.data(), length) != -expected) {
+            throw PUTILS_GENERAL_EXCEPTION("Vectorized comparison mismatches the scalar loop!", "test error");
+        }
+    }
+    return;
+}
+
+int main() {
+    std::mt19937_64 gen(20250815);
+    const char* levels[] = {"scalar", "avx2", "avx512"};
+    std::cout << "SIMD level: " << levels[static_cast<int>(mpengine::simd_level())] << std::endl;
+    for (auto iobasic: {mpengine::IOBasic::oct, mpengine::IOBasic::dec, mpengine::IOBasic::hex}) {
+        for (size_t length = 1; length <= 80; length++) {
+            for (int mode = 0; mode < 2; mode++) {
+                for (int repeat = 0; repeat < 16; repeat++) {
+                    verify_kernels(gen, length, iobasic, mode);
+                }
+            }
+        }
+        verify_kernels(gen, 1 << 16, iobasic, 0);
+        verify_kernels(gen, 1 << 16, iobasic, 1);
+    }
+
+    const size_t length = 1 << 12, rounds = 1 << 12;
+    const uint64_t base = mpengine::iofun::store_base(mpengine::IOBasic::dec);
+    Limbs a = random_limbs(gen, length, base, 0), b = random_limbs(gen, length, base, 0), c(length);
+    auto start = std::chrono::high_resolution_clock::now();
+    for (size_t i = 0; i < rounds; i++) {
+        scalar_addition(a, b, c, base);
+        std::swap(a, c);
+    }
+    auto middle = std::chrono::high_resolution_clock::now();
+    for (size_t i = 0; i < rounds; i++) {
+        mpengine::u64_variable_length_integer_addition_with_carry(a.data(), b.data(), c.data(), length, base);
+        std::swap(a, c);
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    std::cout << "Addition chain of " << rounds << " rounds over " << length << " limbs: scalar "
+              << std::chrono::duration_cast<std::chrono::microseconds>(middle - start).count() << "us, dispatched "
+              << std::chrono::duration_cast<std::chrono::microseconds>(end - middle).count() << "us." << std::endl;
+    return 0;
+}
@@ -3,6 +3,7 @@
 #include <cmath>
 #include <thread>
 #include <condition_variable>
+#include <deque>
 
 #include "LockFreeQueue.hpp"
 #include "GeneralException.h"
@@ -147,6 +148,7 @@ std::shared_ptr<Task> wrap_task(Lambda&& target) noexcept {
  * - Each executor has its own task queue and worker threads
  * - Workers automatically steal work from other queues when idle
  * - Tasks are submitted to random queues to balance load
+ * - A task finding every queue full after a few rounds is parked in an overflow list drained by idle workers
  * - Provides wait_all_done() for synchronization
  *
  * @note The thread pool is implemented as a singleton. Use get_global_threadpool() to access it.
@@ -170,6 +172,10 @@ private:
     static size_t fail_block_threshold;
     static std::atomic<bool> initialized;
     static std::mutex setting_lock;
+    static constexpr size_t submit_rounds = 4;
+    static std::mutex overflow_lock;
+    static std::deque<TaskPtr> overflow_tasks;
+    static std::atomic<size_t> overflow_size;
     Partition executors;
     Partition_view executors_view;
     ThreadPool();
@@ -187,9 +193,11 @@ public:
         size_t fial_block_threshold = ThreadPool::fail_block_threshold
     ) noexcept;
     static ThreadPool& get_global_threadpool() noexcept;
+    static size_t get_num_executors() noexcept;
     void submit(const TaskPtr& task) noexcept;
     void submit(const TaskList& task_list) noexcept;
     TaskPtr work_stealing() noexcept;
+    static TaskPtr pop_overflow() noexcept;
     void shutdown() noexcept;
 };
 
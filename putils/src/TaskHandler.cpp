@@ -28,7 +28,15 @@ workers(), active_workers(num_workers), cv_lock(), cv_inactive(), cv_all_done(),
                             RuntimeLog::Level::WARN
                         )
                     } else if (task_queue_view->empty()) {
-                        if (state.load(std::memory_order_acquire) == INACTIVE || failure_cnt >= fail_threshold) {
+                        if (task_ptr = ThreadPool::pop_overflow(); task_ptr) {
+                            // Tasks parked while every queue was full go before stealing or sleeping.
+                            try {
+                                task_ptr->run();
+                            } PUTILS_CATCH_LOG_GENERAL_MSG(
+                                "(Worker): Task loss due to runtime errors.",
+                                RuntimeLog::Level::WARN
+                            )
+                        } else if (state.load(std::memory_order_acquire) == INACTIVE || failure_cnt >= fail_threshold) {
                             failure_cnt = 0;
                             /* Check the flag 'state' to see if an INACTIVE signal is received.
                                Here it shares the lock cv_lock with wait_all_done(),
@@ -88,7 +96,15 @@ void TaskHandler::wait_all_done() noexcept {
 }
 
 void TaskHandler::activate() noexcept {
-    state.store(ACTIVE, std::memory_order_release);
+    if (state.load(std::memory_order_acquire) == ACTIVE) {
+        return;
+    }
+    {
+        /* The state switches under cv_lock, otherwise a worker having just found it INACTIVE
+           could miss the notification and sleep on a queue that is no longer empty. */
+        std::lock_guard<std::mutex> lock(cv_lock);
+        state.store(ACTIVE, std::memory_order_release);
+    }
     cv_inactive.notify_all();
     return;
 }
@@ -105,6 +121,9 @@ size_t ThreadPool::num_workers_per_executor = 1;
 size_t ThreadPool::fail_block_threshold = 1;
 std::atomic<bool> ThreadPool::initialized{false};
 std::mutex ThreadPool::setting_lock;
+std::mutex ThreadPool::overflow_lock;
+std::deque<ThreadPool::TaskPtr> ThreadPool::overflow_tasks;
+std::atomic<size_t> ThreadPool::overflow_size{0};
 
 ThreadPool::ThreadPool(): executors() {
     std::lock_guard<std::mutex> lock(ThreadPool::setting_lock);
@@ -168,17 +187,31 @@ ThreadPool& ThreadPool::get_global_threadpool() noexcept {
     return threadpool_instance;
 }
 
+size_t ThreadPool::get_num_executors() noexcept {
+    std::lock_guard<std::mutex> lock(ThreadPool::setting_lock);
+    return ThreadPool::num_executors;
+}
+
 void ThreadPool::submit(const TaskPtr& task) noexcept {
-    while(true) {
-        size_t executor_id = get_executor_id();
-        bool successful = executors_view[executor_id]->task_queue_view->try_push(task);
-        if (successful) {
-            executors_view[executor_id]->activate();
-            return;
-        } else {
-            std::this_thread::yield();
+    /* Every queue is tried for a bounded number of rounds, starting from a random one. A task still finding all of them full
+       is parked in the overflow list: the submitters are usually the workers forwarding a wide frontier of ready tasks,
+       and waiting for room would dead-lock once every worker waits on the queues that only the workers drain.
+       Executors are activated before the push: a pushed task may be stolen and finish the whole pipeline at once,
+       and an activation landing after the main thread began shutdown() would keep that executor awake for good. */
+    const size_t starting_id = get_executor_id();
+    for (size_t round = 0; round < ThreadPool::submit_rounds; round++) {
+        for (size_t i = 0, id = starting_id; i < ThreadPool::num_executors; i++, id = (id + 1 == ThreadPool::num_executors) ? 0 : id + 1) {
+            executors_view[id]->activate();
+            if (executors_view[id]->task_queue_view->try_push(task)) {
+                return;
+            }
         }
+        std::this_thread::yield();
     }
+    executors_view[starting_id]->activate();
+    std::lock_guard<std::mutex> lock(ThreadPool::overflow_lock);
+    ThreadPool::overflow_tasks.push_back(task);
+    ThreadPool::overflow_size.fetch_add(1, std::memory_order_release);
     return;
 }
 
@@ -204,6 +237,20 @@ ThreadPool::TaskPtr ThreadPool::work_stealing() noexcept {
     return nullptr;
 }
 
+ThreadPool::TaskPtr ThreadPool::pop_overflow() noexcept {
+    if (ThreadPool::overflow_size.load(std::memory_order_acquire) == 0) {
+        return nullptr;
+    }
+    std::lock_guard<std::mutex> lock(ThreadPool::overflow_lock);
+    if (ThreadPool::overflow_tasks.empty()) {
+        return nullptr;
+    }
+    TaskPtr task = std::move(ThreadPool::overflow_tasks.front());
+    ThreadPool::overflow_tasks.pop_front();
+    ThreadPool::overflow_size.fetch_sub(1, std::memory_order_release);
+    return task;
+}
+
 void ThreadPool::shutdown() noexcept {
     for (auto& executor: executors) {
         executor->wait_all_done();
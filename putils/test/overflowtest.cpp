@@ -0,0 +1,48 @@
+#include "TaskHandler.h"
+
+constexpr size_t NUM_EXECUTORS = 2;
+constexpr size_t EXECUTOR_CAPACITY = 4;
+constexpr size_t FRONTIER_WIDTH = 64;
+constexpr size_t FRONTIER_DEPTH = 2;
+
+std::atomic<size_t> finished{0};
+
+void forward(putils::ThreadPool& thread_pool, size_t depth) {
+    //Every task forwards a frontier far wider than the queues, submitted by the workers themselves.
+    if (depth == FRONTIER_DEPTH) {
+        finished.fetch_add(1, std::memory_order_acq_rel);
+        return;
+    }
+    putils::ThreadPool::TaskList task_list;
+    for (size_t i = 0; i < FRONTIER_WIDTH; i++) {
+        task_list.emplace_back(putils::wrap_task([&thread_pool, depth]() { forward(thread_pool, depth + 1); }));
+    }
+    thread_pool.submit(task_list);
+    return;
+}
+
+int main() {
+    //Two executors of four slots each: the frontier of every level overflows all of the queues.
+    putils::ThreadPool::set_global_threadpool(NUM_EXECUTORS, EXECUTOR_CAPACITY);
+    auto& thread_pool = putils::ThreadPool::get_global_threadpool();
+    const size_t expected = static_cast<size_t>(std::pow(FRONTIER_WIDTH, FRONTIER_DEPTH));
+
+    auto start = std::chrono::high_resolution_clock::now();
+
+    thread_pool.submit(putils::wrap_task([&thread_pool]() { forward(thread_pool, 0); }));
+    while (finished.load(std::memory_order_acquire) != expected) {
+        //A submitter waiting for room in the queues that only the workers drain never gets there.
+        if (std::chrono::high_resolution_clock::now() - start > std::chrono::seconds(60)) {
+            throw PUTILS_GENERAL_EXCEPTION("Wide frontier did not finish, the workers are dead-locked on full queues!", "test error");
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    auto end = std::chrono::high_resolution_clock::now();
+    std::cout << "Frontier of " << expected << " tasks on " << NUM_EXECUTORS << " executors of capacity " << EXECUTOR_CAPACITY << " in "
+              << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count()
+              << "ms" << std::endl;
+
+    thread_pool.shutdown();
+    return 0;
+}